@@ -20,7 +20,10 @@ public class OUUCodingStandard : ModuleRules
 			{
 				"Core",
 				"CoreUObject",
-				"Engine"
+				"Engine",
+				"MassEntity",
+				"NetCore",
+				"SignificanceManager"
 			}
 		);
 	}
@@ -23,13 +23,92 @@
 // [cpp.include.header] Always include the header file corresponding to your cpp file first.
 #include "OUUCodingStandard.h"
 
+#include "Algo/Find.h"
+#include "Async/ParallelFor.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/ThreadSingleton.h"
+#include "MassEntitySubsystem.h"
+#include "MassExecutionContext.h"
+#include "MassExecutor.h"
 #include "Modules/ModuleManager.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Net/UnrealNetwork.h"
+#include "OUUCodingStandardCrowd.h"
+#include "SignificanceManager.h"
+#include "Stats/Stats.h"
+
+#if PLATFORM_CPU_X86_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS
+	#include <emmintrin.h>
+	#if PLATFORM_ALWAYS_HAS_AVX_2
+		#include <immintrin.h>
+	#endif
+#endif
+#include <atomic>
 
 // [order.macro.impl] Implementation macros (e.g. log categories, modules) should come before any other implementations
 IMPLEMENT_MODULE(FDefaultModuleImpl, OUUCodingStandard)
 DEFINE_LOG_CATEGORY(LogOUUCodingStandard);
 
+// [stats.group] Declare one stats group per module and keep stats that are only used in one file in the source file.
+DECLARE_STATS_GROUP(TEXT("OUUCodingStandard"), STATGROUP_OUUCodingStandard, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Suppressed OnAwesomenessChanged Broadcasts"),
+	STAT_OUUCodingStandard_SuppressedAwesomenessChanged,
+	STATGROUP_OUUCodingStandard);
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Saved Multicast RPCs"),
+	STAT_OUUCodingStandard_SavedMulticastRPCs,
+	STATGROUP_OUUCodingStandard);
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Merged Server RPCs"),
+	STAT_OUUCodingStandard_MergedServerRPCs,
+	STATGROUP_OUUCodingStandard);
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Dropped Server RPCs"),
+	STAT_OUUCodingStandard_DroppedServerRPCs,
+	STATGROUP_OUUCodingStandard);
+DECLARE_CYCLE_STAT(
+	TEXT("Server_SendDataToServer"),
+	STAT_OUUCodingStandard_ServerSendDataToServer,
+	STATGROUP_OUUCodingStandard);
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Crowd Members"),
+	STAT_OUUCodingStandard_NumCrowdMembers,
+	STATGROUP_OUUCodingStandard);
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Promoted Crowd Members"),
+	STAT_OUUCodingStandard_NumPromotedCrowdMembers,
+	STATGROUP_OUUCodingStandard);
+DECLARE_CYCLE_STAT(TEXT("Update Crowd"), STAT_OUUCodingStandard_UpdateCrowd, STATGROUP_OUUCodingStandard);
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Character Pool Misses"),
+	STAT_OUUCodingStandard_CharacterPoolMisses,
+	STATGROUP_OUUCodingStandard);
+DECLARE_MEMORY_STAT(
+	TEXT("Frame Arena High Water Mark"),
+	STAT_OUUCodingStandard_FrameArenaHighWaterMark,
+	STATGROUP_OUUCodingStandard);
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Characters (High Significance)"),
+	STAT_OUUCodingStandard_NumHighSignificanceCharacters,
+	STATGROUP_OUUCodingStandard);
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Characters (Medium Significance)"),
+	STAT_OUUCodingStandard_NumMediumSignificanceCharacters,
+	STATGROUP_OUUCodingStandard);
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Characters (Low Significance)"),
+	STAT_OUUCodingStandard_NumLowSignificanceCharacters,
+	STATGROUP_OUUCodingStandard);
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Characters (Lowest Significance)"),
+	STAT_OUUCodingStandard_NumLowestSignificanceCharacters,
+	STATGROUP_OUUCodingStandard);
+
 // [cpp.namespace.private] use a namespace to wrap free functions defined only in the cpp file.
 // Default naming for such a namespace would be ModulePrefix::ModuleName::Private, but you are free to diverge.
 namespace OUU::CodingStandard::Private
@@ -47,11 +126,354 @@ namespace OUU::CodingStandard::Private
 	// - vt: virtual texture
 	// - ... etc
 	// The C++ variable itself should be prefixed with CVar_
+	constexpr int32 DefaultMinAwesomeness = 100;
+
 	TAutoConsoleVariable<int32> CVar_MinAwesomeness(
 		TEXT("ouu.CodingStandard.MinAwesomeness"),
-		100,
+		DefaultMinAwesomeness,
 		TEXT("Sample cvar that defines the minimum int value above 0 at which true awesomeness starts."));
 
+	TAutoConsoleVariable<bool> CVar_BatchMulticastRPCs(
+		TEXT("ouu.CodingStandard.BatchMulticastRPCs"),
+		false,
+		TEXT("If true, multicast data of example characters is queued and sent in a single RPC per frame."));
+
+	TAutoConsoleVariable<float> CVar_ServerDataTokensPerSecond(
+		TEXT("ouu.CodingStandard.ServerDataRateLimit.TokensPerSecond"),
+		10.f,
+		TEXT("Number of Server_SendDataToServer RPCs per second and character the server processes on average. "
+			 "Excess RPCs are dropped. Values <= 0 disable the rate limit."));
+
+	TAutoConsoleVariable<float> CVar_ServerDataBurstSize(
+		TEXT("ouu.CodingStandard.ServerDataRateLimit.BurstSize"),
+		20.f,
+		TEXT("Maximum number of Server_SendDataToServer RPCs per character the server processes in a short burst."));
+
+	TAutoConsoleVariable<bool> CVar_DeferAwesomenessEvents(
+		TEXT("ouu.CodingStandard.DeferAwesomenessEvents"),
+		false,
+		TEXT("If true, OnAwesomenessChanged events of example characters are collected and broadcast at the end of "
+			 "the world tick with only the final awesomeness level, at most once per update interval of their "
+			 "significance bucket. If false, they are broadcast immediately."));
+
+	TAutoConsoleVariable<float> CVar_CrowdPromotionDistance(
+		TEXT("ouu.CodingStandard.Crowd.PromotionDistance"),
+		2000.f,
+		TEXT("Crowd members closer than this to any player viewpoint are promoted to example character actors."));
+
+	TAutoConsoleVariable<float> CVar_CrowdDemotionDistance(
+		TEXT("ouu.CodingStandard.Crowd.DemotionDistance"),
+		2500.f,
+		TEXT("Promoted crowd members farther than this from all player viewpoints are demoted to actor-less crowd "
+			 "members. Clamped to be at least the promotion distance."));
+
+	TAutoConsoleVariable<int32> CVar_CrowdMaxPromotionsPerFrame(
+		TEXT("ouu.CodingStandard.Crowd.MaxPromotionsPerFrame"),
+		8,
+		TEXT("Maximum number of crowd member actors spawned per frame. Spreads out spawn costs when players move "
+			 "into dense crowds."));
+
+	TAutoConsoleVariable<int32> CVar_CharacterPoolMaxSize(
+		TEXT("ouu.CodingStandard.CharacterPool.MaxSize"),
+		256,
+		TEXT("Maximum number of deactivated example characters kept per world for reuse. Released characters beyond "
+			 "this limit are destroyed."));
+
+	TAutoConsoleVariable<bool> CVar_UpdateSignificanceManager(
+		TEXT("ouu.CodingStandard.Significance.UpdateManager"),
+		false,
+		TEXT("If true, the example character subsystem updates the significance manager with all player viewpoints "
+			 "at the end of every frame. Only enable this if the game doesn't update the significance manager itself, "
+			 "because the manager is shared by all systems in the world."));
+
+	// [cvar.cache] Cvars that are read in hot code paths (e.g. per character per frame or from worker threads) should
+	// be cached in an atomic snapshot that is refreshed by a console variable sink. Reads are then a single relaxed
+	// load instead of a cvar lookup.
+	// NOTE: std::atomic is one of the exceptions to [basic.stl], because TAtomic is deprecated in favor of it.
+	std::atomic<int32> CachedMinAwesomeness{DefaultMinAwesomeness};
+
+	void RefreshCachedMinAwesomeness()
+	{
+		CachedMinAwesomeness.store(CVar_MinAwesomeness.GetValueOnGameThread(), std::memory_order_relaxed);
+	}
+
+	// Sinks are invoked on the game thread after any cvar changed, including the initial ini/command line values.
+	FAutoConsoleVariableSink CVarSink_MinAwesomeness(
+		FConsoleCommandDelegate::CreateStatic(&RefreshCachedMinAwesomeness));
+
+	int32 GetMinAwesomeness()
+	{
+		return CachedMinAwesomeness.load(std::memory_order_relaxed);
+	}
+
+	const TMap<FName, int32>& GetBodyPartIndexMap()
+	{
+		// Built on first use instead of during static initialization, so the body part names are guaranteed to exist.
+		static const TMap<FName, int32> BodyPartIndices = []() {
+			TMap<FName, int32> Result;
+			Result.Reserve(AOUUExampleCharacter::NumBodyParts);
+			for (int32 BodyPartIndex = 0; BodyPartIndex < AOUUExampleCharacter::NumBodyParts; ++BodyPartIndex)
+			{
+				Result.Add(AOUUExampleCharacter::BodyPartNames[BodyPartIndex], BodyPartIndex);
+			}
+			return Result;
+		}();
+		return BodyPartIndices;
+	}
+
+	// Colors written to the custom primitive data of the character meshes, indexed by EOUUExampleBodyPartColor.
+	const FLinearColor BodyPartLinearColors[] = {
+		FLinearColor(1.f, 0.f, 0.f),
+		FLinearColor(0.f, 1.f, 0.f),
+		FLinearColor(0.f, 0.f, 1.f)};
+	static_assert(
+		UE_ARRAY_COUNT(BodyPartLinearColors) == static_cast<int32>(EOUUExampleBodyPartColor::Count),
+		"Missing linear color for body part color");
+
+	const FName CharacterSignificanceTag = TEXT("OUUExampleCharacter");
+
+	// Maximum view distance of each significance bucket, indexed by EOUUExampleCharacterSignificance.
+	// Characters that are farther away than all of these are in the last bucket.
+	constexpr double SignificanceMaxDistances[] = {1500.0, 4000.0, 10000.0};
+	static_assert(
+		UE_ARRAY_COUNT(SignificanceMaxDistances) == static_cast<int32>(EOUUExampleCharacterSignificance::Count) - 1,
+		"Missing max distance for significance bucket");
+
+	// Tick and event update interval in seconds of each significance bucket.
+	constexpr float SignificanceUpdateIntervals[] = {0.f, 0.1f, 0.25f, 1.f};
+	static_assert(
+		UE_ARRAY_COUNT(SignificanceUpdateIntervals) == static_cast<int32>(EOUUExampleCharacterSignificance::Count),
+		"Missing update interval for significance bucket");
+
+	float GetSignificanceUpdateInterval(EOUUExampleCharacterSignificance Significance)
+	{
+		return SignificanceUpdateIntervals[static_cast<int32>(Significance)];
+	}
+
+	// Called by the significance manager on worker threads. Higher values are more significant.
+	float CalculateCharacterSignificance(
+		USignificanceManager::FManagedObjectInfo* ObjectInfo,
+		const FTransform& Viewpoint)
+	{
+		constexpr int32 NumSignificances = static_cast<int32>(EOUUExampleCharacterSignificance::Count);
+		const auto* Character = CastChecked<AOUUExampleCharacter>(ObjectInfo->GetObject());
+		const double DistanceSquared = FVector::DistSquared(Character->GetActorLocation(), Viewpoint.GetLocation());
+
+		int32 Bucket = 0;
+		while (Bucket < NumSignificances - 1 && DistanceSquared > FMath::Square(SignificanceMaxDistances[Bucket]))
+		{
+			++Bucket;
+		}
+
+		// Off-screen characters drop one bucket. Dedicated servers never render, so only the distance counts there.
+		if (!IsRunningDedicatedServer() && !Character->WasRecentlyRendered())
+		{
+			Bucket = FMath::Min(Bucket + 1, NumSignificances - 1);
+		}
+
+		return static_cast<float>(NumSignificances - 1 - Bucket);
+	}
+
+	// Large enough chunks to amortize the task overhead and to avoid false sharing on the output arrays.
+	constexpr int32 ParallelChunkSize = 1024;
+
+	void ParallelAwesomenessLevelsFromIntValues(
+		TArrayView<const int32> Awesomeness,
+		TArrayView<EAwesomenessLevel> OutAwesomenessLevels)
+	{
+		const int32 NumChunks = FMath::DivideAndRoundUp(Awesomeness.Num(), ParallelChunkSize);
+		ParallelFor(
+			NumChunks,
+			[Input = Awesomeness, Output = OutAwesomenessLevels](int32 ChunkIndex) {
+				const int32 ChunkStart = ChunkIndex * ParallelChunkSize;
+				const int32 ChunkNum = FMath::Min(ParallelChunkSize, Input.Num() - ChunkStart);
+				AwesomenessLevelsFromIntValues(Input.Slice(ChunkStart, ChunkNum), Output.Slice(ChunkStart, ChunkNum));
+			},
+			NumChunks > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+	}
+
+	// Size of regular frame arena chunks. Larger allocations get a dedicated chunk.
+	constexpr SIZE_T FrameArenaChunkSize = 64 * 1024;
+	constexpr uint32 FrameArenaChunkAlignment = 64;
+
+	// Byte pattern that overwrites all memory of an arena when it is reset, so stale reads are easy to spot.
+	constexpr uint8 FrameArenaPoisonByte = 0xCD;
+
+	// Largest number of bytes any thread arena handed out within a single frame.
+	// Alignment padding and the unused ends of chunks are not included.
+	std::atomic<SIZE_T> FrameArenaHighWaterMark{0};
+
+	void UpdateFrameArenaHighWaterMark(SIZE_T NumBytesUsed)
+	{
+		SIZE_T PreviousHighWaterMark = FrameArenaHighWaterMark.load(std::memory_order_relaxed);
+		while (NumBytesUsed > PreviousHighWaterMark
+			   && !FrameArenaHighWaterMark.compare_exchange_weak(
+				   PreviousHighWaterMark,
+				   NumBytesUsed,
+				   std::memory_order_relaxed))
+		{
+		}
+
+		if (NumBytesUsed > PreviousHighWaterMark)
+		{
+			SET_MEMORY_STAT(STAT_OUUCodingStandard_FrameArenaHighWaterMark, NumBytesUsed);
+		}
+	}
+
+	// Arena of a single thread -> see FFrameArena
+	// A thread singleton instead of a thread_local, so arenas are freed when their thread exits and not during static
+	// destruction, when the allocator may already be gone.
+	class FThreadFrameArena : public TThreadSingleton<FThreadFrameArena>
+	{
+	public:
+		FThreadFrameArena() = default;
+		FThreadFrameArena(const FThreadFrameArena&) = delete;
+		FThreadFrameArena& operator=(const FThreadFrameArena&) = delete;
+		~FThreadFrameArena() override;
+
+		void* Allocate(SIZE_T NumBytes, uint32 Alignment);
+		void* Reallocate(
+			void* Ptr,
+			SIZE_T NumBytesToKeep,
+			SIZE_T NewNumBytes,
+			uint64 AllocationFrame,
+			uint32 Alignment);
+
+	private:
+		struct FChunk
+		{
+			uint8* Memory = nullptr;
+			SIZE_T Size = 0;
+		};
+
+		// Regular chunks are kept across frames, so the arena stops allocating once it reached its high water mark.
+		// Dedicated chunks of larger allocations are freed on reset, so a single spike doesn't pin its memory.
+		TArray<FChunk> Chunks;
+		int32 CurrentChunkIndex = 0;
+		SIZE_T CurrentOffset = 0;
+		void* LastAllocation = nullptr;
+		// Sum of the sizes of all live allocations of the current frame, for the high water mark stat.
+		SIZE_T NumBytesUsed = 0;
+		uint64 CurrentFrame = MAX_uint64;
+
+		void ResetIfNewFrame();
+	};
+
+	FThreadFrameArena::~FThreadFrameArena()
+	{
+		for (const FChunk& Chunk : Chunks)
+		{
+			FMemory::Free(Chunk.Memory);
+		}
+	}
+
+	void* FThreadFrameArena::Allocate(SIZE_T NumBytes, uint32 Alignment)
+	{
+		ResetIfNewFrame();
+		Alignment = FMath::Max(Alignment, FFrameArena::MinAlignment);
+
+		for (; CurrentChunkIndex < Chunks.Num(); ++CurrentChunkIndex, CurrentOffset = 0)
+		{
+			const FChunk& Chunk = Chunks[CurrentChunkIndex];
+			uint8* Result = Align(Chunk.Memory + CurrentOffset, Alignment);
+			if (Result + NumBytes <= Chunk.Memory + Chunk.Size)
+			{
+				CurrentOffset = static_cast<SIZE_T>(Result + NumBytes - Chunk.Memory);
+				LastAllocation = Result;
+				NumBytesUsed += NumBytes;
+				return Result;
+			}
+		}
+
+		const SIZE_T ChunkSize = FMath::Max(FrameArenaChunkSize, NumBytes + Alignment);
+		Chunks.Add({static_cast<uint8*>(FMemory::Malloc(ChunkSize, FrameArenaChunkAlignment)), ChunkSize});
+		CurrentChunkIndex = Chunks.Num() - 1;
+		CurrentOffset = 0;
+		return Allocate(NumBytes, Alignment);
+	}
+
+	void* FThreadFrameArena::Reallocate(
+		void* Ptr,
+		SIZE_T NumBytesToKeep,
+		SIZE_T NewNumBytes,
+		uint64 AllocationFrame,
+		uint32 Alignment)
+	{
+		if (NewNumBytes == 0)
+			return nullptr;
+
+		// Memory of an earlier frame may already be handed out again, or be overwritten by the reset below. It must
+		// neither be copied nor be mistaken for the most recent allocation of this frame.
+		const bool bIsStale = Ptr && AllocationFrame != GFrameCounter;
+		UE_CLOG(
+			bIsStale && NumBytesToKeep > 0,
+			LogOUUCodingStandard,
+			Fatal,
+			TEXT("Frame arena memory of frame %llu was reallocated in frame %llu. Containers using "
+				 "FFrameArenaAllocator must not be kept beyond the frame they allocated in."),
+			AllocationFrame,
+			GFrameCounter);
+		if (bIsStale)
+		{
+			Ptr = nullptr;
+		}
+
+		// The most recent allocation can simply be extended or shrunk by moving the end of the arena.
+		if (Ptr && Ptr == LastAllocation && CurrentFrame == GFrameCounter)
+		{
+			const FChunk& Chunk = Chunks[CurrentChunkIndex];
+			uint8* Start = static_cast<uint8*>(Ptr);
+			if (Start + NewNumBytes <= Chunk.Memory + Chunk.Size)
+			{
+				const SIZE_T OldNumBytes = static_cast<SIZE_T>(Chunk.Memory + CurrentOffset - Start);
+				NumBytesUsed = NumBytesUsed - OldNumBytes + NewNumBytes;
+				CurrentOffset = static_cast<SIZE_T>(Start + NewNumBytes - Chunk.Memory);
+				return Ptr;
+			}
+		}
+
+		void* Result = Allocate(NewNumBytes, Alignment);
+		if (Ptr)
+		{
+			FMemory::Memcpy(Result, Ptr, FMath::Min(NumBytesToKeep, NewNumBytes));
+		}
+		return Result;
+	}
+
+	void FThreadFrameArena::ResetIfNewFrame()
+	{
+		if (CurrentFrame == GFrameCounter)
+			return;
+
+		CurrentFrame = GFrameCounter;
+		if (Chunks.Num() == 0)
+			return;
+
+		UpdateFrameArenaHighWaterMark(NumBytesUsed);
+		NumBytesUsed = 0;
+
+#if DO_CHECK
+		for (int32 ChunkIndex = 0; ChunkIndex <= CurrentChunkIndex; ++ChunkIndex)
+		{
+			const SIZE_T NumBytesToPoison = ChunkIndex == CurrentChunkIndex ? CurrentOffset : Chunks[ChunkIndex].Size;
+			FMemory::Memset(Chunks[ChunkIndex].Memory, FrameArenaPoisonByte, NumBytesToPoison);
+		}
+#endif
+
+		for (int32 ChunkIndex = Chunks.Num() - 1; ChunkIndex >= 0; --ChunkIndex)
+		{
+			if (Chunks[ChunkIndex].Size > FrameArenaChunkSize)
+			{
+				FMemory::Free(Chunks[ChunkIndex].Memory);
+				Chunks.RemoveAtSwap(ChunkIndex);
+			}
+		}
+
+		CurrentChunkIndex = 0;
+		CurrentOffset = 0;
+		LastAllocation = nullptr;
+	}
+
 	// [doc.namespace] Namespaces do not need doc comments at the beginning, but ending braces should be followed by a
 	// matching comment like this (will be auto-enforced by clang-format).
 } // namespace OUU::CodingStandard::Private
@@ -233,6 +655,25 @@ namespace OUU::CodingStandard::Private::IsolatedSamples
 		constexpr int32 MinNegativeIntValue = TNumericLimits<int32>::Min();
 	}
 
+	//---------------------------------------------------------------------------------------------------------------------
+	const TCHAR* SwitchCases(EAwesomenessLevel AwesomenessLevel)
+	{
+		// [switch.braces] Braces are optional around cases in switch/case blocks.
+		// When placing braces around a case block, the final break or return statement is placed inside the brace
+		// scope.
+		switch (AwesomenessLevel)
+		{
+		case EAwesomenessLevel::NotAwesome:
+			// [string.literal] String literals in production code should always use the TEXT() macro
+			return TEXT("NotAwesome");
+			// not to be confused with INVTEXT() macro for FText literals!
+			// return INVTEXT("NotAwesome");
+		case EAwesomenessLevel::SemiAwesome: return TEXT("SemiAwesome");
+		case EAwesomenessLevel::Awesome: return TEXT("Awesome");
+		default: return TEXT("<invalid>");
+		}
+	}
+
 	//---------------------------------------------------------------------------------------------------------------------
 	void Macros()
 	{
@@ -246,6 +687,148 @@ namespace OUU::CodingStandard::Private::IsolatedSamples
 	}
 } // namespace OUU::CodingStandard::Private::IsolatedSamples
 
+namespace OUU::CodingStandard::Templates::Private
+{
+#if PLATFORM_CPU_X86_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS
+	template <typename BitsType>
+	FORCEINLINE __m128i VectorBroadcast128(BitsType Item)
+	{
+		if constexpr (sizeof(BitsType) == 1)
+		{
+			return _mm_set1_epi8(static_cast<int8>(Item));
+		}
+		else if constexpr (sizeof(BitsType) == 2)
+		{
+			return _mm_set1_epi16(static_cast<int16>(Item));
+		}
+		else if constexpr (sizeof(BitsType) == 4)
+		{
+			return _mm_set1_epi32(static_cast<int32>(Item));
+		}
+		else
+		{
+			return _mm_set1_epi64x(static_cast<int64>(Item));
+		}
+	}
+
+	// @returns a mask with one bit per byte that is set for all bytes of lanes that compare equal.
+	template <typename BitsType>
+	FORCEINLINE uint32 VectorCompareEqualMask128(__m128i A, __m128i B)
+	{
+		if constexpr (sizeof(BitsType) == 1)
+		{
+			return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(A, B)));
+		}
+		else if constexpr (sizeof(BitsType) == 2)
+		{
+			return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi16(A, B)));
+		}
+		else if constexpr (sizeof(BitsType) == 4)
+		{
+			return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi32(A, B)));
+		}
+		else
+		{
+			// SSE2 has no 64 bit comparison, so both 32 bit halves of a lane must be equal.
+			const __m128i Equal32 = _mm_cmpeq_epi32(A, B);
+			const __m128i Equal64 = _mm_and_si128(Equal32, _mm_shuffle_epi32(Equal32, _MM_SHUFFLE(2, 3, 0, 1)));
+			return static_cast<uint32>(_mm_movemask_epi8(Equal64));
+		}
+	}
+
+	#if PLATFORM_ALWAYS_HAS_AVX_2
+	template <typename BitsType>
+	FORCEINLINE __m256i VectorBroadcast256(BitsType Item)
+	{
+		return _mm256_broadcastsi128_si256(VectorBroadcast128(Item));
+	}
+
+	// @returns a mask with one bit per byte that is set for all bytes of lanes that compare equal.
+	template <typename BitsType>
+	FORCEINLINE uint32 VectorCompareEqualMask256(__m256i A, __m256i B)
+	{
+		if constexpr (sizeof(BitsType) == 1)
+		{
+			return static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(A, B)));
+		}
+		else if constexpr (sizeof(BitsType) == 2)
+		{
+			return static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(A, B)));
+		}
+		else if constexpr (sizeof(BitsType) == 4)
+		{
+			return static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi32(A, B)));
+		}
+		else
+		{
+			return static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi64(A, B)));
+		}
+	}
+	#endif
+#endif
+
+	//---------------------------------------------------------------------------------------------------------------------
+	template <typename BitsType>
+	int32 VectorizedFindBitsImpl(const BitsType* Data, int32 Num, BitsType Item)
+	{
+		int32 Index = 0;
+#if PLATFORM_CPU_X86_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS
+		constexpr int32 NumLaneBytes = static_cast<int32>(sizeof(BitsType));
+	#if PLATFORM_ALWAYS_HAS_AVX_2
+		constexpr int32 NumLanes256 = 32 / NumLaneBytes;
+		const __m256i Needle256 = VectorBroadcast256(Item);
+		for (; Index + NumLanes256 <= Num; Index += NumLanes256)
+		{
+			const __m256i Values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Data + Index));
+			const uint32 EqualMask = VectorCompareEqualMask256<BitsType>(Values, Needle256);
+			if (EqualMask != 0)
+				return Index + static_cast<int32>(FMath::CountTrailingZeros(EqualMask)) / NumLaneBytes;
+		}
+	#endif
+		constexpr int32 NumLanes128 = 16 / NumLaneBytes;
+		const __m128i Needle128 = VectorBroadcast128(Item);
+		for (; Index + NumLanes128 <= Num; Index += NumLanes128)
+		{
+			const __m128i Values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + Index));
+			const uint32 EqualMask = VectorCompareEqualMask128<BitsType>(Values, Needle128);
+			if (EqualMask != 0)
+				return Index + static_cast<int32>(FMath::CountTrailingZeros(EqualMask)) / NumLaneBytes;
+		}
+#endif
+
+		for (; Index < Num; ++Index)
+		{
+			if (Data[Index] == Item)
+				return Index;
+		}
+		return INDEX_NONE;
+	}
+
+	//---------------------------------------------------------------------------------------------------------------------
+	int32 VectorizedFindBits(const uint8* Data, int32 Num, uint8 Item)
+	{
+		return VectorizedFindBitsImpl(Data, Num, Item);
+	}
+
+	//---------------------------------------------------------------------------------------------------------------------
+	int32 VectorizedFindBits(const uint16* Data, int32 Num, uint16 Item)
+	{
+		return VectorizedFindBitsImpl(Data, Num, Item);
+	}
+
+	//---------------------------------------------------------------------------------------------------------------------
+	int32 VectorizedFindBits(const uint32* Data, int32 Num, uint32 Item)
+	{
+		return VectorizedFindBitsImpl(Data, Num, Item);
+	}
+
+	//---------------------------------------------------------------------------------------------------------------------
+	int32 VectorizedFindBits(const uint64* Data, int32 Num, uint64 Item)
+	{
+		return VectorizedFindBitsImpl(Data, Num, Item);
+	}
+} // namespace OUU::CodingStandard::Templates::Private
+
 // [namespace.func.impl] Create namespace scopes in the cpp file instead of inlining the namespace name into the
 // function signatures, e.g. here: FString OUU::CodingStandards::LexToString(EAwesomenessLevel AwesomenessLevel).
 namespace OUU::CodingStandard
@@ -260,42 +843,169 @@ namespace OUU::CodingStandard
 
 		// [magic.number] Do not use magic numbers. Instead, use named global constants or cvars.
 		// if (Awesomeness < 100)
-		if (Awesomeness < Private::CVar_MinAwesomeness.GetValueOnAnyThread())
+		if (Awesomeness < Private::GetMinAwesomeness())
 			return EAwesomenessLevel::SemiAwesome;
 
 		return EAwesomenessLevel::Awesome;
 	}
 
 	//---------------------------------------------------------------------------------------------------------------------
-	FString LexToString(EAwesomenessLevel AwesomenessLevel)
+	void AwesomenessLevelsFromIntValues(
+		TArrayView<const int32> Awesomeness,
+		TArrayView<EAwesomenessLevel> OutAwesomenessLevels)
 	{
-		// [switch.braces] Braces are optional around cases in switch/case blocks.
-		// When placing braces around a case block, the final break or return statement is placed inside the brace
-		// scope.
-		switch (AwesomenessLevel)
+		check(Awesomeness.Num() == OutAwesomenessLevels.Num());
+
+		// The kernels below compute the level arithmetically and write it as int32 lanes, which is only valid as long
+		// as the enum layout matches these assumptions.
+		static_assert(sizeof(EAwesomenessLevel) == sizeof(int32), "Levels are stored as int32 vector lanes");
+		static_assert(static_cast<int32>(EAwesomenessLevel::NotAwesome) == 0, "NotAwesome must be level 0");
+		static_assert(static_cast<int32>(EAwesomenessLevel::SemiAwesome) == 1, "SemiAwesome must be level 1");
+		static_assert(static_cast<int32>(EAwesomenessLevel::Awesome) == 2, "Awesome must be level 2");
+
+		// Read the threshold once for the whole batch, so all values are evaluated against the same snapshot.
+		const int32 MinAwesomeness = Private::GetMinAwesomeness();
+		const int32 Num = Awesomeness.Num();
+		const int32* Source = Awesomeness.GetData();
+		int32* Destination = reinterpret_cast<int32*>(OutAwesomenessLevels.GetData());
+
+		int32 Index = 0;
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+		// Branchless equivalent of AwesomenessLevelFromIntValue():
+		// Level = (Value >= 0) ? 1 + (Value >= MinAwesomeness) : 0
+		// Vector comparisons yield -1 for true, so 1 - (-1) = 2 and 1 - 0 = 1.
+		const VectorRegister4Int Zero = GlobalVectorConstants::IntZero;
+		const VectorRegister4Int One = GlobalVectorConstants::IntOne;
+		const VectorRegister4Int Threshold = VectorIntSet1(MinAwesomeness);
+		for (; Index + 4 <= Num; Index += 4)
 		{
-		case EAwesomenessLevel::NotAwesome:
-			// [string.literal] String literals in production code should always use the TEXT() macro
-			return TEXT("NotAwesome");
-			// not to be confused with INVTEXT() macro for FText literals!
-			// return INVTEXT("NotAwesome");
-		case EAwesomenessLevel::SemiAwesome: return TEXT("SemiAwesome");
-		case EAwesomenessLevel::Awesome: return TEXT("Awesome");
-		default: return TEXT("<invalid>");
+			const VectorRegister4Int Values = VectorIntLoad(Source + Index);
+			const VectorRegister4Int NonNegativeMask = VectorIntCompareGE(Values, Zero);
+			const VectorRegister4Int AboveThresholdMask = VectorIntCompareGE(Values, Threshold);
+			const VectorRegister4Int Levels =
+				VectorIntAnd(NonNegativeMask, VectorIntSubtract(One, AboveThresholdMask));
+			VectorIntStore(Levels, Destination + Index);
+		}
+#endif
+
+		// Scalar fallback and remainder that does not fill a whole vector register.
+		for (; Index < Num; ++Index)
+		{
+			const int32 Value = Source[Index];
+			if (Value < 0)
+			{
+				OutAwesomenessLevels[Index] = EAwesomenessLevel::NotAwesome;
+			}
+			else if (Value < MinAwesomeness)
+			{
+				OutAwesomenessLevels[Index] = EAwesomenessLevel::SemiAwesome;
+			}
+			else
+			{
+				OutAwesomenessLevels[Index] = EAwesomenessLevel::Awesome;
+			}
 		}
 	}
 
 	//---------------------------------------------------------------------------------------------------------------------
-	bool TryLexFromString(EAwesomenessLevel& OutAwesomenessLevel, const FString& String) { return false; }
+	FString LexToString(EAwesomenessLevel AwesomenessLevel)
+	{
+		return FString(LexToStringView(AwesomenessLevel));
+	}
+
+	//---------------------------------------------------------------------------------------------------------------------
+	bool TryLexFromString(EAwesomenessLevel& OutAwesomenessLevel, FStringView String)
+	{
+		// All level names have distinct lengths, so the length alone selects the only candidate that needs a full
+		// string comparison. Colliding names would result in duplicate case labels and fail to compile.
+		EAwesomenessLevel Candidate;
+		switch (String.Len())
+		{
+		case LexToStringView(EAwesomenessLevel::NotAwesome).Len(): Candidate = EAwesomenessLevel::NotAwesome; break;
+		case LexToStringView(EAwesomenessLevel::SemiAwesome).Len(): Candidate = EAwesomenessLevel::SemiAwesome; break;
+		case LexToStringView(EAwesomenessLevel::Awesome).Len(): Candidate = EAwesomenessLevel::Awesome; break;
+		default: return false;
+		}
+
+		if (!String.Equals(LexToStringView(Candidate), ESearchCase::IgnoreCase))
+			return false;
+
+		OutAwesomenessLevel = Candidate;
+		return true;
+	}
+
+	const FName FNumericAwesomeness::UnknownAwesomenessReason = TEXT("unknown reason");
 } // namespace OUU::CodingStandard
 
 // [cpp.divider.class] If a cpp file contains function definitions for multiple classes, place a separator
 // in the following format above the first function definition of each class
+//---------------------------------------------------------------------------------------------------------------------
+// FOUUExampleBodyPartColorItem
+//---------------------------------------------------------------------------------------------------------------------
+void FOUUExampleBodyPartColorItem::PostReplicatedAdd(const FOUUExampleBodyPartColorArray& InArraySerializer)
+{
+	PostReplicatedChange(InArraySerializer);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void FOUUExampleBodyPartColorItem::PostReplicatedChange(const FOUUExampleBodyPartColorArray& InArraySerializer)
+{
+	if (InArraySerializer.OwningCharacter)
+	{
+		InArraySerializer.OwningCharacter->HandleBodyPartColorReplicated(BodyPartIndex, BodyPartColor);
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool FOUUExampleBodyPartColorItem::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	// SerializeInt() writes at most ceil(log2(Max)) bits on bit writers, e.g. up to 2 bits for three colors.
+	constexpr uint32 NumBodyParts = AOUUExampleCharacter::NumBodyParts;
+	constexpr uint32 NumBodyPartColors = static_cast<uint32>(EOUUExampleBodyPartColor::Count);
+
+	uint32 PackedBodyPartIndex = BodyPartIndex;
+	uint32 PackedBodyPartColor = static_cast<uint32>(BodyPartColor);
+	Ar.SerializeInt(PackedBodyPartIndex, NumBodyParts);
+	Ar.SerializeInt(PackedBodyPartColor, NumBodyPartColors);
+
+	bOutSuccess = true;
+	if (Ar.IsLoading())
+	{
+		// Never trust data from the network: Out of range values are clamped and reported as failure.
+		bOutSuccess = PackedBodyPartIndex < NumBodyParts && PackedBodyPartColor < NumBodyPartColors;
+		BodyPartIndex = static_cast<uint8>(FMath::Min(PackedBodyPartIndex, NumBodyParts - 1));
+		BodyPartColor = static_cast<EOUUExampleBodyPartColor>(FMath::Min(PackedBodyPartColor, NumBodyPartColors - 1));
+	}
+
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// FFrameArena
+//---------------------------------------------------------------------------------------------------------------------
+void* OUU::CodingStandard::FFrameArena::Allocate(SIZE_T NumBytes, uint32 Alignment)
+{
+	return Private::FThreadFrameArena::Get().Allocate(NumBytes, Alignment);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void* OUU::CodingStandard::FFrameArena::Reallocate(
+	void* Ptr,
+	SIZE_T NumBytesToKeep,
+	SIZE_T NewNumBytes,
+	uint64 AllocationFrame,
+	uint32 Alignment)
+{
+	return Private::FThreadFrameArena::Get().Reallocate(Ptr, NumBytesToKeep, NewNumBytes, AllocationFrame, Alignment);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // AOUUExampleCharacter
 //---------------------------------------------------------------------------------------------------------------------
 const FName AOUUExampleCharacter::HeadBodyPartName = TEXT("Head");
 const FName AOUUExampleCharacter::TorsoBodyPartName = TEXT("Body");
+const FName AOUUExampleCharacter::BodyPartNames[NumBodyParts] = {HeadBodyPartName, TorsoBodyPartName};
+const FName AOUUExampleCharacter::SetAwesomenessReason = TEXT("set by SetAwesomeness");
 
 //---------------------------------------------------------------------------------------------------------------------
 AOUUExampleCharacter::AOUUExampleCharacter() : AOUUExampleCharacter(nullptr, EOUUExampleBodyPartColor::Red) {}
@@ -305,13 +1015,15 @@ AOUUExampleCharacter::AOUUExampleCharacter() : AOUUExampleCharacter(nullptr, EOU
 // possible.
 // [ctor.initialization] Member initialization should only happen in a single constructor. Other constructors should
 // call the same delegating constructor to initialize any member variables.
-AOUUExampleCharacter::AOUUExampleCharacter(USkeletalMesh* InSkeletalMesh, EOUUExampleBodyPartColor InHeadColor) :
-	HeadColor(InHeadColor)
+AOUUExampleCharacter::AOUUExampleCharacter(USkeletalMesh* InSkeletalMesh, EOUUExampleBodyPartColor InHeadColor)
 {
 	HeadMeshComponent = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("HeadMesh"));
 	// Attach the head mesh to the character mesh = body mesh
 	HeadMeshComponent->SetupAttachment(GetMesh());
 	HeadMeshComponent->SetSkeletalMesh(InSkeletalMesh);
+
+	BodyPartColors[HeadBodyPartIndex] = InHeadColor;
+	ResetBodyPartColorUses();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -320,19 +1032,52 @@ EAwesomenessLevel AOUUExampleCharacter::GetAwesomenessLevel() const
 	return CharacterData.GetAwesomenessLevel();
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+int32 AOUUExampleCharacter::GetAwesomeness() const
+{
+	return static_cast<int32>(CharacterData);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void AOUUExampleCharacter::SetAwesomeness(int32 Awesomeness)
 {
 	const auto AwesomenessLevelBefore = CharacterData.GetAwesomenessLevel();
 
-	CharacterData = FCharacterData(Awesomeness, TEXT("set by SetAwesomeness"));
+	CharacterData = FCharacterData(Awesomeness, SetAwesomenessReason);
 	const auto NewAwesomenessLevel = CharacterData.GetAwesomenessLevel();
 
+	// Listeners may query the subsystem, so it must be up to date before they are notified.
+	if (CharacterSubsystem)
+	{
+		CharacterSubsystem->UpdateCharacter(*this);
+	}
+
 	if (NewAwesomenessLevel != AwesomenessLevelBefore)
 	// [braces.one_per_line] Follow "Allman" style aka one line per brace
 	{
-		OnAwesomenessChanged.Broadcast(NewAwesomenessLevel);
+		BroadcastAwesomenessChanged(AwesomenessLevelBefore);
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::FlushDeferredAwesomenessChanged()
+{
+	if (!AwesomenessLevelBeforeDeferral.IsSet())
+		return;
+
+	const EAwesomenessLevel AwesomenessLevelBefore = AwesomenessLevelBeforeDeferral.GetValue();
+	AwesomenessLevelBeforeDeferral.Reset();
+
+	const EAwesomenessLevel NewAwesomenessLevel = GetAwesomenessLevel();
+	if (NewAwesomenessLevel == AwesomenessLevelBefore)
+	{
+		// The level flipped back during the frame, so there is nothing to report.
+		INC_DWORD_STAT(STAT_OUUCodingStandard_SuppressedAwesomenessChanged);
+		return;
 	}
+
+	LastDeferredAwesomenessFlushTime = GetWorld()->GetTimeSeconds();
+	OnAwesomenessChanged.Broadcast(NewAwesomenessLevel);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -340,23 +1085,166 @@ bool AOUUExampleCharacter::HasAllColorsPossible() const
 {
 	// [enum.range.use] If you have functions like this that need to iterate over all possible cases of an enum,
 	// you should declare the enum ranges statically -> see [enum.range.decl]
+#if DO_GUARD_SLOW
 	for (const auto Color : TEnumRange<EOUUExampleBodyPartColor>())
 	{
-		if (HeadColor != Color && TorsoColor != Color)
-			return false;
+		checkSlow(
+			(BodyPartColorUseCounts[static_cast<int32>(Color)] > 0)
+			== (Algo::Find(BodyPartColors, Color) != nullptr));
 	}
-	return true;
+#endif
+
+	return UsedBodyPartColorsMask == AllBodyPartColorsMask;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-void AOUUExampleCharacter::BeginPlay()
+uint8 AOUUExampleCharacter::GetUsedBodyPartColorsMask() const
 {
-	// [function.super] Always call the super function, or comment it out with an explicit reason why you omitted the
-	// super-call. This is especially true for gameplay framework functions like BeginPlay(), Tick(), etc.
-	Super::BeginPlay();
-
-	// [log.temp] Never check-in code that uses LogTemp.
-	// UE_LOG(LogTemp, Log, TEXT("AOUUExampleCharacter::BeginPlay"))
+	return UsedBodyPartColorsMask;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int32 AOUUExampleCharacter::GetScore() const
+{
+	return Score;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+EOUUExampleCharacterSignificance AOUUExampleCharacter::GetSignificance() const
+{
+	return Significance;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::SetScore(int32 NewScore)
+{
+	if (Score == NewScore)
+		return;
+
+	Score = NewScore;
+	// [net.pushmodel] Push-model properties are only compared for replication after they were explicitly marked dirty.
+	// Every write to such a property must be followed by marking it dirty.
+	MARK_PROPERTY_DIRTY_FROM_NAME(AOUUExampleCharacter, Score, this);
+
+	if (CharacterSubsystem)
+	{
+		CharacterSubsystem->UpdateCharacter(*this);
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool AOUUExampleCharacter::ColorBodyPartByIndex(int32 BodyPartIndex, EOUUExampleBodyPartColor BodyPartColor)
+{
+	EOUUExampleBodyPartColor OldBodyPartColor;
+	if (!TryApplyBodyPartColor(BodyPartIndex, BodyPartColor, OldBodyPartColor))
+		return false;
+
+	if (OldBodyPartColor == BodyPartColor)
+		return true;
+
+	BroadcastBodyPartColorChanged(BodyPartIndex, OldBodyPartColor, BodyPartColor);
+
+	const FOUUExampleBodyPartColorChange BodyPartColorChange(
+		BodyPartNames[BodyPartIndex],
+		OldBodyPartColor,
+		BodyPartColor);
+	BroadcastBodyPartColorsChanged(MakeArrayView(&BodyPartColorChange, 1));
+
+	HandleBodyPartColorsChanged();
+
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+EOUUExampleBodyPartColor AOUUExampleCharacter::GetBodyPartColor(int32 BodyPartIndex) const
+{
+	check(BodyPartIndex >= 0 && BodyPartIndex < NumBodyParts);
+	return BodyPartColors[BodyPartIndex];
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::SendDataToEveryone()
+{
+	if (!HasAuthority())
+		return;
+
+	if (CharacterSubsystem && OUU::CodingStandard::Private::CVar_BatchMulticastRPCs.GetValueOnGameThread())
+	{
+		CharacterSubsystem->QueueMulticastData(*this);
+		return;
+	}
+
+	Multicast_SendDataToEveryone();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::SendDataToServer()
+{
+	if (bHasPendingServerData)
+	{
+		INC_DWORD_STAT(STAT_OUUCodingStandard_MergedServerRPCs);
+		return;
+	}
+
+	if (!CharacterSubsystem)
+	{
+		Server_SendDataToServer();
+		return;
+	}
+
+	bHasPendingServerData = true;
+	CharacterSubsystem->QueuePendingServerData(*this);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::FlushPendingServerData()
+{
+	if (!bHasPendingServerData)
+		return;
+
+	bHasPendingServerData = false;
+	Server_SendDataToServer();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int32 AOUUExampleCharacter::GetNumDroppedServerRPCs() const
+{
+	return NumDroppedServerRPCs;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int32 AOUUExampleCharacter::FindBodyPartIndex(FName BodyPartName)
+{
+	const int32* BodyPartIndex = OUU::CodingStandard::Private::GetBodyPartIndexMap().Find(BodyPartName);
+	return BodyPartIndex ? *BodyPartIndex : INDEX_NONE;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	ReplicatedBodyPartColors.OwningCharacter = this;
+
+	if (bDriveHeadByLeaderPose)
+	{
+		// The body mesh pushes its bone transforms to the head, so the head does not need to tick on its own.
+		HeadMeshComponent->SetLeaderPoseComponent(GetMesh());
+		HeadMeshComponent->SetComponentTickEnabled(false);
+	}
+
+	UpdateBodyPartColorPrimitiveData();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::BeginPlay()
+{
+	// [function.super] Always call the super function, or comment it out with an explicit reason why you omitted the
+	// super-call. This is especially true for gameplay framework functions like BeginPlay(), Tick(), etc.
+	Super::BeginPlay();
+
+	// [log.temp] Never check-in code that uses LogTemp.
+	// UE_LOG(LogTemp, Log, TEXT("AOUUExampleCharacter::BeginPlay"))
 
 	// [log.verbosity] Status logs that are not interesting for the general developer should be checked-in with
 	// 'Verbose' verbosity or higher.
@@ -366,6 +1254,13 @@ void AOUUExampleCharacter::BeginPlay()
 	// Delegate name without 'On' prefix, e.g. this->OnAwesomenessChanged becomes HandleOwnAwesomenessChanged
 	BoundDelegateHandle =
 		this->OnAwesomenessChanged.AddUObject(this, &AOUUExampleCharacter::HandleOwnAwesomenessChanged);
+
+	if (HasAuthority())
+	{
+		InitializeReplicatedBodyPartColors();
+	}
+
+	RegisterWithCharacterSubsystem();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -376,6 +1271,8 @@ void AOUUExampleCharacter::EndPlay(EEndPlayReason::Type EndPlayReason)
 	// [delegate.cleanup] Always clean up bound delegates
 	this->OnAwesomenessChanged.Remove(BoundDelegateHandle);
 	BoundDelegateHandle.Reset();
+
+	UnregisterFromCharacterSubsystem();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -413,62 +1310,1354 @@ bool AOUUExampleCharacter::ColorBodyPart(FName BodyPartName, EOUUExampleBodyPart
 		TorsoColor = BodyPartColor;
 	}
 #endif
+	return ColorBodyPartByIndex(FindBodyPartIndex(BodyPartName), BodyPartColor);
 	// STUDIO End
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool AOUUExampleCharacter::ColorBodyParts(TConstArrayView<FOUUExampleBodyPartColorEntry> NewBodyPartColors)
+{
+	bool bColoredAllBodyParts = true;
+	// Every body part changes at most once per call unless the caller passes duplicates, so the changes of a regular
+	// outfit swap never leave the inline storage.
+	TArray<FOUUExampleBodyPartColorChange, TInlineAllocator<NumBodyParts>> BodyPartColorChanges;
+	TArray<int32, TInlineAllocator<NumBodyParts>> ChangedBodyPartIndices;
+
+	for (const FOUUExampleBodyPartColorEntry& BodyPartColorEntry : NewBodyPartColors)
+	{
+		const FName BodyPartName = BodyPartColorEntry.BodyPartName;
+		const EOUUExampleBodyPartColor NewBodyPartColor = BodyPartColorEntry.BodyPartColor;
+		const int32 BodyPartIndex = FindBodyPartIndex(BodyPartName);
+
+		EOUUExampleBodyPartColor OldBodyPartColor;
+		if (!TryApplyBodyPartColor(BodyPartIndex, NewBodyPartColor, OldBodyPartColor))
+		{
+			bColoredAllBodyParts = false;
+			continue;
+		}
+
+		if (OldBodyPartColor != NewBodyPartColor)
+		{
+			BodyPartColorChanges.Emplace(BodyPartName, OldBodyPartColor, NewBodyPartColor);
+			ChangedBodyPartIndices.Add(BodyPartIndex);
+		}
+	}
+
+	if (BodyPartColorChanges.Num() > 0)
+	{
+		// Per body part listeners are only notified once all colors are applied, so they see the complete outfit.
+		for (int32 ChangeIndex = 0; ChangeIndex < BodyPartColorChanges.Num(); ++ChangeIndex)
+		{
+			const FOUUExampleBodyPartColorChange& BodyPartColorChange = BodyPartColorChanges[ChangeIndex];
+			BroadcastBodyPartColorChanged(
+				ChangedBodyPartIndices[ChangeIndex],
+				BodyPartColorChange.OldBodyPartColor,
+				BodyPartColorChange.NewBodyPartColor);
+		}
+
+		BroadcastBodyPartColorsChanged(BodyPartColorChanges);
+		HandleBodyPartColorsChanged();
+	}
+
+	return bColoredAllBodyParts;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::Server_SendDataToServer_Implementation()
+{
+	SCOPE_CYCLE_COUNTER(STAT_OUUCodingStandard_ServerSendDataToServer);
+
+	if (!TryConsumeServerDataToken())
+	{
+		++NumDroppedServerRPCs;
+		INC_DWORD_STAT(STAT_OUUCodingStandard_DroppedServerRPCs);
+		UE_LOG(
+			LogOUUCodingStandard,
+			VeryVerbose,
+			TEXT("%s - Dropped rate limited Server_SendDataToServer"),
+			*GetName());
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::Client_SendDataToClient_Implementation() {}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::Multicast_SendDataToEveryone_Implementation()
+{
+	ReceiveDataFromEveryone();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::SetBodyPartColor(int32 BodyPartIndex, EOUUExampleBodyPartColor NewColor)
+{
+	EOUUExampleBodyPartColor& BodyPartColor = BodyPartColors[BodyPartIndex];
+	if (BodyPartColor == NewColor)
+		return;
+
+	RemoveBodyPartColorUse(BodyPartColor);
+	BodyPartColor = NewColor;
+	AddBodyPartColorUse(NewColor);
+
+	if (CharacterSubsystem)
+	{
+		CharacterSubsystem->UpdateCharacter(*this);
+	}
+
+	// The replicated items are only created on the server in BeginPlay, which also picks up earlier changes.
+	auto& Items = ReplicatedBodyPartColors.Items;
+	if (HasAuthority() && Items.IsValidIndex(BodyPartIndex))
+	{
+		Items[BodyPartIndex].BodyPartColor = NewColor;
+		ReplicatedBodyPartColors.MarkItemDirty(Items[BodyPartIndex]);
+		MARK_PROPERTY_DIRTY_FROM_NAME(AOUUExampleCharacter, ReplicatedBodyPartColors, this);
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool AOUUExampleCharacter::TryApplyBodyPartColor(
+	int32 BodyPartIndex,
+	EOUUExampleBodyPartColor NewColor,
+	EOUUExampleBodyPartColor& OutOldColor)
+{
+	if (BodyPartIndex < 0 || BodyPartIndex >= NumBodyParts)
+		return false;
+
+	if (!ensureMsgf(
+			NewColor != EOUUExampleBodyPartColor::Count,
+			TEXT("%s - Count case must never be used to color body parts"),
+			*GetName()))
+	{
+		return false;
+	}
+
+	OutOldColor = BodyPartColors[BodyPartIndex];
+	SetBodyPartColor(BodyPartIndex, NewColor);
+	return true;
+}
 
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::HandleBodyPartColorsChanged()
+{
 	// [comment.todo] If you leave todo comments, start with #TODO, so we can find them and add a developer that should
 	// take care of the todo.
 	// #TODO username: Update mesh materials based on enum state
 	bWasColorChanged = true;
+	UpdateBodyPartColorPrimitiveData();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::UpdateBodyPartColorPrimitiveData()
+{
+	if (IsNetMode(NM_DedicatedServer))
+		return;
 
-	return false;
+	// Custom primitive data keeps all characters on the same material instances, so they can still be batched and
+	// instanced. Dynamic material instances per body part would break that and allocate for every character.
+	for (int32 BodyPartIndex = 0; BodyPartIndex < NumBodyParts; ++BodyPartIndex)
+	{
+		const FLinearColor& Color =
+			OUU::CodingStandard::Private::BodyPartLinearColors[static_cast<int32>(BodyPartColors[BodyPartIndex])];
+		const FVector ColorVector(Color.R, Color.G, Color.B);
+		const int32 DataIndex = BodyPartIndex * BodyPartColorPrimitiveDataStride;
+		GetMesh()->SetCustomPrimitiveDataVector3(DataIndex, ColorVector);
+		HeadMeshComponent->SetCustomPrimitiveDataVector3(DataIndex, ColorVector);
+	}
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-void AOUUExampleCharacter::Server_SendDataToServer_Implementation() {}
+void AOUUExampleCharacter::BroadcastBodyPartColorChanged(
+	int32 BodyPartIndex,
+	EOUUExampleBodyPartColor OldBodyPartColor,
+	EOUUExampleBodyPartColor NewBodyPartColor) const
+{
+	const FName BodyPartName = BodyPartNames[BodyPartIndex];
+
+	OnBodyPartColorChangedNative.Broadcast(BodyPartName, OldBodyPartColor, NewBodyPartColor);
+	if (OnBodyPartColorChanged.IsBound())
+	{
+		OnBodyPartColorChanged.Broadcast(BodyPartName, OldBodyPartColor, NewBodyPartColor);
+	}
+
+	switch (BodyPartIndex)
+	{
+	case HeadBodyPartIndex:
+	{
+		OnHeadColorChangedNative.Broadcast(BodyPartName, OldBodyPartColor, NewBodyPartColor);
+		if (OnHeadColorChanged.IsBound())
+		{
+			OnHeadColorChanged.Broadcast(BodyPartName, OldBodyPartColor, NewBodyPartColor);
+		}
+		break;
+	}
+	case TorsoBodyPartIndex:
+	{
+		OnTorsoColorChangedNative.Broadcast(BodyPartName, OldBodyPartColor, NewBodyPartColor);
+		if (OnTorsoColorChanged.IsBound())
+		{
+			OnTorsoColorChanged.Broadcast(BodyPartName, OldBodyPartColor, NewBodyPartColor);
+		}
+		break;
+	}
+	default: break;
+	}
+}
 
 //---------------------------------------------------------------------------------------------------------------------
-void AOUUExampleCharacter::Client_SendDataToClient_Implementation() {}
+void AOUUExampleCharacter::BroadcastBodyPartColorsChanged(
+	TConstArrayView<FOUUExampleBodyPartColorChange> BodyPartColorChanges) const
+{
+	OnBodyPartColorsChangedNative.Broadcast(BodyPartColorChanges);
+	if (OnBodyPartColorsChanged.IsBound())
+	{
+		OnBodyPartColorsChanged.Broadcast(TArray<FOUUExampleBodyPartColorChange>(BodyPartColorChanges));
+	}
+}
 
 //---------------------------------------------------------------------------------------------------------------------
-void AOUUExampleCharacter::Multicast_SendDataToEveryone_Implementation() {}
+void AOUUExampleCharacter::AddBodyPartColorUse(EOUUExampleBodyPartColor Color)
+{
+	const int32 ColorIndex = static_cast<int32>(Color);
+	if (!ensureMsgf(ColorIndex < NumBodyPartColors, TEXT("%s - Invalid body part color"), *GetName()))
+		return;
+
+	++BodyPartColorUseCounts[ColorIndex];
+	UsedBodyPartColorsMask |= 1 << ColorIndex;
+}
 
 //---------------------------------------------------------------------------------------------------------------------
-void AOUUExampleCharacter::HandleOwnAwesomenessChanged(EAwesomenessLevel Awesomeness) const
+void AOUUExampleCharacter::RemoveBodyPartColorUse(EOUUExampleBodyPartColor Color)
 {
-	// [braces.always] Always use braces, even for single line if-statements.
-	// only exception: early-returns -> see [earlyreturn]
-	if (Awesomeness == EAwesomenessLevel::Awesome)
+	const int32 ColorIndex = static_cast<int32>(Color);
+	if (!ensureMsgf(
+			ColorIndex < NumBodyPartColors && BodyPartColorUseCounts[ColorIndex] > 0,
+			TEXT("%s - Body part color use counts are out of sync"),
+			*GetName()))
 	{
-		UE_LOG(LogOUUCodingStandard, Log, TEXT("Character %s just became AWESOME!"), *GetName());
+		return;
 	}
 
-	// ...for the specific case above you can use UE_CLOG as alternative:
-	UE_CLOG(
-		Awesomeness == EAwesomenessLevel::Awesome,
-		LogOUUCodingStandard,
-		Log,
-		TEXT("Character %s just became AWESOME!"),
-		*GetName());
+	if (--BodyPartColorUseCounts[ColorIndex] == 0)
+	{
+		UsedBodyPartColorsMask &= ~(1 << ColorIndex);
+	}
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-void AOUUExampleCharacter::OnRep_Score(int32 ReplicatedScore) {}
+void AOUUExampleCharacter::ResetBodyPartColorUses()
+{
+	FMemory::Memzero(BodyPartColorUseCounts);
+	UsedBodyPartColorsMask = 0;
+	for (const auto BodyPartColor : BodyPartColors)
+	{
+		AddBodyPartColorUse(BodyPartColor);
+	}
+}
 
 //---------------------------------------------------------------------------------------------------------------------
-// [func.replprops] This function is auto-declared by UHT for any AActor with replicated properties.
-// Because we do not have a matching declaration in the header file, it should be implemented at the end of the list of
-// member function definitions in the cpp file.
-// The output parameter OutLifetimeProps must not be renamed, otherwise the DOREPLIFETIME macros do not work.
-void AOUUExampleCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+void AOUUExampleCharacter::InitializeReplicatedBodyPartColors()
 {
-	DOREPLIFETIME(AOUUExampleCharacter, Score);
+	auto& Items = ReplicatedBodyPartColors.Items;
+	Items.Reset(NumBodyParts);
+	ReplicatedBodyPartColors.MarkArrayDirty();
+	for (int32 BodyPartIndex = 0; BodyPartIndex < NumBodyParts; ++BodyPartIndex)
+	{
+		auto& Item = Items.AddDefaulted_GetRef();
+		Item.BodyPartIndex = static_cast<uint8>(BodyPartIndex);
+		Item.BodyPartColor = BodyPartColors[BodyPartIndex];
+		ReplicatedBodyPartColors.MarkItemDirty(Item);
+	}
+	MARK_PROPERTY_DIRTY_FROM_NAME(AOUUExampleCharacter, ReplicatedBodyPartColors, this);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-// UOUUExampleBlueprintFunctionLibrary
+void AOUUExampleCharacter::HandleBodyPartColorReplicated(int32 BodyPartIndex, EOUUExampleBodyPartColor NewColor)
+{
+	// Goes through the regular recolor path, so clients receive the same events as the server.
+	const bool bColoredBodyPart = ColorBodyPartByIndex(BodyPartIndex, NewColor);
+	ensureMsgf(
+		bColoredBodyPart,
+		TEXT("%s - Received invalid body part color replication for body part %i"),
+		*GetName(),
+		BodyPartIndex);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
-int32 UOUUExampleBlueprintFunctionLibrary::GetAwesomenessThreshold()
+void AOUUExampleCharacter::BroadcastAwesomenessChanged(EAwesomenessLevel AwesomenessLevelBefore)
 {
-	// Could be called from animation thread in animation blueprints, so any thread.
-	return OUU::CodingStandard::Private::CVar_MinAwesomeness.GetValueOnAnyThread();
+	if (!TryDeferAwesomenessChanged(AwesomenessLevelBefore))
+	{
+		OnAwesomenessChanged.Broadcast(GetAwesomenessLevel());
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool AOUUExampleCharacter::TryDeferAwesomenessChanged(EAwesomenessLevel AwesomenessLevelBefore)
+{
+	// Once deferred, events are throttled to the update interval of the significance bucket of the character.
+	if (!OUU::CodingStandard::Private::CVar_DeferAwesomenessEvents.GetValueOnGameThread())
+		return false;
+
+	if (AwesomenessLevelBeforeDeferral.IsSet())
+	{
+		// Already queued. Only the final level will be broadcast.
+		INC_DWORD_STAT(STAT_OUUCodingStandard_SuppressedAwesomenessChanged);
+		return true;
+	}
+
+	if (!CharacterSubsystem)
+		return false;
+
+	AwesomenessLevelBeforeDeferral = AwesomenessLevelBefore;
+	CharacterSubsystem->QueueDeferredAwesomenessChanged(*this);
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool AOUUExampleCharacter::IsDeferredAwesomenessFlushDue(double CurrentTime) const
+{
+	const float UpdateInterval = OUU::CodingStandard::Private::GetSignificanceUpdateInterval(Significance);
+	return CurrentTime >= LastDeferredAwesomenessFlushTime + UpdateInterval;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::SetSignificance(EOUUExampleCharacterSignificance NewSignificance)
+{
+	if (Significance == NewSignificance)
+		return;
+
+	Significance = NewSignificance;
+	// With leader pose, the body mesh interval also throttles the pose updates of the head.
+	const float UpdateInterval = OUU::CodingStandard::Private::GetSignificanceUpdateInterval(Significance);
+	SetActorTickInterval(UpdateInterval);
+	GetMesh()->SetComponentTickInterval(UpdateInterval);
+	HeadMeshComponent->SetComponentTickInterval(UpdateInterval);
+
+	if (CharacterSubsystem)
+	{
+		CharacterSubsystem->UpdateCharacter(*this);
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool AOUUExampleCharacter::TryConsumeServerDataToken()
+{
+	const float TokensPerSecond = OUU::CodingStandard::Private::CVar_ServerDataTokensPerSecond.GetValueOnGameThread();
+	if (TokensPerSecond <= 0.f)
+		return true;
+
+	const float BurstSize = OUU::CodingStandard::Private::CVar_ServerDataBurstSize.GetValueOnGameThread();
+	const double Now = GetWorld()->GetRealTimeSeconds();
+	const double SecondsSinceRefill = Now - LastServerDataTokenRefillTime;
+	ServerDataTokens = static_cast<float>(
+		FMath::Min<double>(BurstSize, static_cast<double>(ServerDataTokens) + SecondsSinceRefill * TokensPerSecond));
+	LastServerDataTokenRefillTime = Now;
+
+	if (ServerDataTokens < 1.f)
+		return false;
+
+	ServerDataTokens -= 1.f;
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::RegisterWithCharacterSubsystem()
+{
+	if (const UWorld* World = GetWorld())
+	{
+		CharacterSubsystem = World->GetSubsystem<UOUUExampleCharacterSubsystem>();
+		if (CharacterSubsystem)
+		{
+			CharacterSubsystem->RegisterCharacter(*this);
+		}
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::UnregisterFromCharacterSubsystem()
+{
+	if (CharacterSubsystem)
+	{
+		CharacterSubsystem->UnregisterCharacter(*this);
+		CharacterSubsystem = nullptr;
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::ResetForPool()
+{
+	// Unregister first, so the resets below don't update the registry or queue any end of frame work.
+	UnregisterFromCharacterSubsystem();
+
+	// Listeners of the previous use must not receive events of the next one. Only keep the own binding.
+	OnAwesomenessChanged.Clear();
+	BoundDelegateHandle =
+		this->OnAwesomenessChanged.AddUObject(this, &AOUUExampleCharacter::HandleOwnAwesomenessChanged);
+	OnBodyPartColorChanged.Clear();
+	OnHeadColorChanged.Clear();
+	OnTorsoColorChanged.Clear();
+	OnBodyPartColorsChanged.Clear();
+	OnBodyPartColorChangedNative.Clear();
+	OnHeadColorChangedNative.Clear();
+	OnTorsoColorChangedNative.Clear();
+	OnBodyPartColorsChangedNative.Clear();
+
+	CharacterData = FCharacterData();
+	AwesomenessLevelBeforeDeferral.Reset();
+	LastDeferredAwesomenessFlushTime = 0.0;
+	SetSignificance(EOUUExampleCharacterSignificance::High);
+	bHasPendingServerData = false;
+	ServerDataTokens = TNumericLimits<float>::Max();
+	LastServerDataTokenRefillTime = 0.0;
+	NumDroppedServerRPCs = 0;
+	if (HasAuthority())
+	{
+		SetScore(0);
+	}
+
+	// Nobody is listening anymore, so the colors can be reset without going through the change events.
+	const auto* ClassDefaults = GetDefault<AOUUExampleCharacter>(GetClass());
+	for (int32 BodyPartIndex = 0; BodyPartIndex < NumBodyParts; ++BodyPartIndex)
+	{
+		SetBodyPartColor(BodyPartIndex, ClassDefaults->BodyPartColors[BodyPartIndex]);
+	}
+	HandleBodyPartColorsChanged();
+	bWasColorChanged = false;
+
+	HeadMeshComponent->SetSkeletalMesh(ClassDefaults->HeadMeshComponent->GetSkeletalMeshAsset());
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
+	GetCharacterMovement()->StopMovementImmediately();
+	GetCharacterMovement()->Deactivate();
+
+	// Hidden meshes still tick and evaluate their pose, so their ticks are disabled as well.
+	GetMesh()->SetComponentTickEnabled(false);
+	HeadMeshComponent->SetComponentTickEnabled(false);
+
+	if (Controller)
+	{
+		Controller->UnPossess();
+	}
+
+	// Pooled characters don't change, so there is nothing to replicate until they are reactivated.
+	// The changes above are still sent before the channel goes dormant.
+	if (HasAuthority())
+	{
+		SetNetDormancy(DORM_DormantAll);
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::ActivateFromPool(const FTransform& Transform)
+{
+	SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetActorTickEnabled(PrimaryActorTick.bStartWithTickEnabled);
+	GetCharacterMovement()->Activate(true);
+
+	GetMesh()->SetComponentTickEnabled(GetMesh()->PrimaryComponentTick.bStartWithTickEnabled);
+	// The head keeps its tick disabled while it copies the body pose -> see PostInitializeComponents()
+	HeadMeshComponent->SetComponentTickEnabled(
+		!bDriveHeadByLeaderPose && HeadMeshComponent->PrimaryComponentTick.bStartWithTickEnabled);
+
+	if (HasAuthority())
+	{
+		SetNetDormancy(GetDefault<AOUUExampleCharacter>(GetClass())->NetDormancy);
+		FlushNetDormancy();
+	}
+
+	RegisterWithCharacterSubsystem();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::HandleOwnAwesomenessChanged(EAwesomenessLevel Awesomeness) const
+{
+	// [braces.always] Always use braces, even for single line if-statements.
+	// only exception: early-returns -> see [earlyreturn]
+	if (Awesomeness == EAwesomenessLevel::Awesome)
+	{
+		UE_LOG(LogOUUCodingStandard, Log, TEXT("Character %s just became AWESOME!"), *GetName());
+	}
+
+	// ...for the specific case above you can use UE_CLOG as alternative:
+	UE_CLOG(
+		Awesomeness == EAwesomenessLevel::Awesome,
+		LogOUUCodingStandard,
+		Log,
+		TEXT("Character %s just became AWESOME!"),
+		*GetName());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::OnRep_Score(int32 ReplicatedScore)
+{
+	if (CharacterSubsystem)
+	{
+		CharacterSubsystem->UpdateCharacter(*this);
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacter::ReceiveDataFromEveryone() {}
+
+//---------------------------------------------------------------------------------------------------------------------
+// [func.replprops] This function is auto-declared by UHT for any AActor with replicated properties.
+// Because we do not have a matching declaration in the header file, it should be implemented at the end of the list of
+// member function definitions in the cpp file.
+// The output parameter OutLifetimeProps must not be renamed, otherwise the DOREPLIFETIME macros do not work.
+void AOUUExampleCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	// [net.pushmodel] Prefer push-model replication for properties that change rarely compared to the net update rate.
+	// The net driver then skips comparing them unless they were marked dirty -> see SetScore()
+	FDoRepLifetimeParams PushModelParams;
+	PushModelParams.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AOUUExampleCharacter, Score, PushModelParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AOUUExampleCharacter, ReplicatedBodyPartColors, PushModelParams);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// UOUUExampleBlueprintFunctionLibrary
+//---------------------------------------------------------------------------------------------------------------------
+int32 UOUUExampleBlueprintFunctionLibrary::GetAwesomenessThreshold()
+{
+	// Could be called from animation thread in animation blueprints, so any thread.
+	return OUU::CodingStandard::Private::GetMinAwesomeness();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// AOUUExampleCharacterRPCBatcher
+//---------------------------------------------------------------------------------------------------------------------
+AOUUExampleCharacterRPCBatcher::AOUUExampleCharacterRPCBatcher()
+{
+	bReplicates = true;
+	bAlwaysRelevant = true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AOUUExampleCharacterRPCBatcher::Multicast_SendBatchedDataToEveryone_Implementation(
+	const TArray<AOUUExampleCharacter*>& Senders)
+{
+	for (auto* Sender : Senders)
+	{
+		if (Sender)
+		{
+			Sender->ReceiveDataFromEveryone();
+		}
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// UOUUExampleCrowdAwesomenessProcessor
+//---------------------------------------------------------------------------------------------------------------------
+UOUUExampleCrowdAwesomenessProcessor::UOUUExampleCrowdAwesomenessProcessor() : EntityQuery(*this)
+{
+	bAutoRegisterWithProcessingPhases = false;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCrowdAwesomenessProcessor::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FOUUExampleAwesomenessFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FOUUExampleAwesomenessLevelFragment>(EMassFragmentAccess::ReadWrite);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCrowdAwesomenessProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	// The fragments only wrap a single value, so chunk fragment views can be fed to the batch conversion directly.
+	static_assert(sizeof(FOUUExampleAwesomenessFragment) == sizeof(int32));
+	static_assert(alignof(FOUUExampleAwesomenessFragment) == alignof(int32));
+	static_assert(sizeof(FOUUExampleAwesomenessLevelFragment) == sizeof(EAwesomenessLevel));
+	static_assert(alignof(FOUUExampleAwesomenessLevelFragment) == alignof(EAwesomenessLevel));
+
+	EntityQuery.ForEachEntityChunk(EntityManager, Context, [](FMassExecutionContext& ChunkContext) {
+		const auto AwesomenessList = ChunkContext.GetFragmentView<FOUUExampleAwesomenessFragment>();
+		const auto AwesomenessLevelList = ChunkContext.GetMutableFragmentView<FOUUExampleAwesomenessLevelFragment>();
+		OUU::CodingStandard::AwesomenessLevelsFromIntValues(
+			MakeArrayView(reinterpret_cast<const int32*>(AwesomenessList.GetData()), AwesomenessList.Num()),
+			MakeArrayView(
+				reinterpret_cast<EAwesomenessLevel*>(AwesomenessLevelList.GetData()),
+				AwesomenessLevelList.Num()));
+	});
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// UOUUExampleCharacterSubsystem
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::RegisterCharacter(AOUUExampleCharacter& Character)
+{
+	if (!ensureMsgf(
+			Character.RegistryIndex == INDEX_NONE,
+			TEXT("%s - Character is already registered"),
+			*Character.GetName()))
+	{
+		return;
+	}
+
+	Character.RegistryIndex = Registry.Characters.Add(&Character);
+	Registry.Awesomeness.AddUninitialized();
+	Registry.AwesomenessLevels.AddUninitialized();
+	Registry.UsedBodyPartColorsMasks.AddUninitialized();
+	Registry.Scores.AddUninitialized();
+	Registry.Significances.AddUninitialized();
+	UpdateCharacter(Character);
+
+	if (auto* SignificanceManager = USignificanceManager::Get(GetWorld()))
+	{
+		// The post significance function is a lambda, so it has the same access to the character as the subsystem.
+		SignificanceManager->RegisterObject(
+			&Character,
+			OUU::CodingStandard::Private::CharacterSignificanceTag,
+			&OUU::CodingStandard::Private::CalculateCharacterSignificance,
+			USignificanceManager::EPostSignificanceType::Sequential,
+			[](USignificanceManager::FManagedObjectInfo* ObjectInfo,
+			   float OldSignificance,
+			   float Significance,
+			   bool bFinal) {
+				const int32 Bucket = NumSignificances - 1 - FMath::RoundToInt(Significance);
+				CastChecked<AOUUExampleCharacter>(ObjectInfo->GetObject())
+					->SetSignificance(static_cast<EOUUExampleCharacterSignificance>(Bucket));
+			});
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::UnregisterCharacter(AOUUExampleCharacter& Character)
+{
+	const int32 Index = Character.RegistryIndex;
+	if (!ensureMsgf(
+			Registry.Characters.IsValidIndex(Index) && Registry.Characters[Index] == &Character,
+			TEXT("%s - Character is not registered"),
+			*Character.GetName()))
+	{
+		return;
+	}
+
+	// Swap removal keeps the arrays dense. The character that was moved into the gap needs to know its new index.
+	Registry.Characters.RemoveAtSwap(Index);
+	Registry.Awesomeness.RemoveAtSwap(Index);
+	Registry.AwesomenessLevels.RemoveAtSwap(Index);
+	Registry.UsedBodyPartColorsMasks.RemoveAtSwap(Index);
+	Registry.Scores.RemoveAtSwap(Index);
+	Registry.Significances.RemoveAtSwap(Index);
+	if (Registry.Characters.IsValidIndex(Index))
+	{
+		Registry.Characters[Index]->RegistryIndex = Index;
+	}
+
+	Character.RegistryIndex = INDEX_NONE;
+
+	// Released characters are reused instead of destroyed, so their weak pointers in the end of frame queues would
+	// still resolve and flush work of the previous use.
+	CharactersWithDeferredAwesomenessChanges.Remove(&Character);
+	CharactersWithQueuedMulticastData.Remove(&Character);
+	CharactersWithPendingServerData.Remove(&Character);
+
+	if (auto* SignificanceManager = USignificanceManager::Get(GetWorld()))
+	{
+		SignificanceManager->UnregisterObject(&Character);
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::UpdateCharacter(const AOUUExampleCharacter& Character)
+{
+	const int32 Index = Character.RegistryIndex;
+	if (Index == INDEX_NONE)
+		return;
+
+	Registry.Awesomeness[Index] = Character.GetAwesomeness();
+	Registry.AwesomenessLevels[Index] = Character.GetAwesomenessLevel();
+	Registry.UsedBodyPartColorsMasks[Index] = Character.GetUsedBodyPartColorsMask();
+	Registry.Scores[Index] = Character.GetScore();
+	Registry.Significances[Index] = Character.GetSignificance();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int32 UOUUExampleCharacterSubsystem::GetNumCharacters() const
+{
+	return Registry.Characters.Num();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TStaticArray<int32, UOUUExampleCharacterSubsystem::NumAwesomenessLevels> UOUUExampleCharacterSubsystem::
+	CountCharactersByAwesomenessLevel() const
+{
+	TStaticArray<int32, NumAwesomenessLevels> Result(InPlace, 0);
+	for (const EAwesomenessLevel AwesomenessLevel : Registry.AwesomenessLevels)
+	{
+		++Result[static_cast<int32>(AwesomenessLevel)];
+	}
+	return Result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int32 UOUUExampleCharacterSubsystem::CountCharactersWithAllColors() const
+{
+	int32 Result = 0;
+	for (const uint8 UsedBodyPartColorsMask : Registry.UsedBodyPartColorsMasks)
+	{
+		Result += UsedBodyPartColorsMask == AOUUExampleCharacter::AllBodyPartColorsMask ? 1 : 0;
+	}
+	return Result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int64 UOUUExampleCharacterSubsystem::GetTotalScore() const
+{
+	int64 Result = 0;
+	for (const int32 Score : Registry.Scores)
+	{
+		Result += Score;
+	}
+	return Result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TStaticArray<int32, UOUUExampleCharacterSubsystem::NumSignificances> UOUUExampleCharacterSubsystem::
+	CountCharactersBySignificance() const
+{
+	TStaticArray<int32, NumSignificances> Result(InPlace, 0);
+	for (const EOUUExampleCharacterSignificance Significance : Registry.Significances)
+	{
+		++Result[static_cast<int32>(Significance)];
+	}
+	return Result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::UpdateAwesomenessLevels()
+{
+	LastMinAwesomeness = OUU::CodingStandard::Private::GetMinAwesomeness();
+
+	const int32 NumCharacters = Registry.Characters.Num();
+	UpdatedAwesomenessLevels.SetNumUninitialized(NumCharacters);
+	OUU::CodingStandard::Private::ParallelAwesomenessLevelsFromIntValues(
+		Registry.Awesomeness,
+		UpdatedAwesomenessLevels);
+
+	// Collect all changes before broadcasting, because listeners may add or remove characters from the registry.
+	TArray<TPair<TWeakObjectPtr<AOUUExampleCharacter>, EAwesomenessLevel>> ChangedCharacters;
+	for (int32 Index = 0; Index < NumCharacters; ++Index)
+	{
+		const EAwesomenessLevel OldAwesomenessLevel = Registry.AwesomenessLevels[Index];
+		if (UpdatedAwesomenessLevels[Index] == OldAwesomenessLevel)
+			continue;
+
+		Registry.AwesomenessLevels[Index] = UpdatedAwesomenessLevels[Index];
+		ChangedCharacters.Emplace(Registry.Characters[Index], OldAwesomenessLevel);
+	}
+
+	for (const auto& ChangedCharacter : ChangedCharacters)
+	{
+		if (auto* Character = ChangedCharacter.Key.Get())
+		{
+			Character->BroadcastAwesomenessChanged(ChangedCharacter.Value);
+		}
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+FOUUExampleCrowdMemberHandle UOUUExampleCharacterSubsystem::AddCrowdMember(
+	const FVector& Location,
+	int32 Awesomeness,
+	TConstArrayView<EOUUExampleBodyPartColor> BodyPartColors)
+{
+	ensureMsgf(
+		BodyPartColors.Num() <= AOUUExampleCharacter::NumBodyParts,
+		TEXT("Crowd member has %i body part colors, but characters only have %i body parts"),
+		BodyPartColors.Num(),
+		AOUUExampleCharacter::NumBodyParts);
+
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!ensureMsgf(EntityManager, TEXT("Crowd members require the Mass entity subsystem")))
+		return FOUUExampleCrowdMemberHandle();
+
+	if (!Crowd->Archetype.IsValid())
+	{
+		Crowd->Archetype = EntityManager->CreateArchetype(
+			{FOUUExampleCrowdLocationFragment::StaticStruct(),
+			 FOUUExampleAwesomenessFragment::StaticStruct(),
+			 FOUUExampleAwesomenessLevelFragment::StaticStruct(),
+			 FOUUExampleBodyPartColorsFragment::StaticStruct(),
+			 FOUUExampleCrowdCharacterFragment::StaticStruct()});
+	}
+
+	const FMassEntityHandle CrowdMember = EntityManager->CreateEntity(Crowd->Archetype);
+	EntityManager->GetFragmentDataChecked<FOUUExampleCrowdLocationFragment>(CrowdMember).Location = Location;
+	EntityManager->GetFragmentDataChecked<FOUUExampleAwesomenessFragment>(CrowdMember).Awesomeness = Awesomeness;
+	EntityManager->GetFragmentDataChecked<FOUUExampleAwesomenessLevelFragment>(CrowdMember).AwesomenessLevel =
+		OUU::CodingStandard::AwesomenessLevelFromIntValue(Awesomeness);
+
+	auto& CrowdMemberColors =
+		EntityManager->GetFragmentDataChecked<FOUUExampleBodyPartColorsFragment>(CrowdMember).BodyPartColors;
+	const int32 NumBodyPartColors = FMath::Min(BodyPartColors.Num(), AOUUExampleCharacter::NumBodyParts);
+	for (int32 BodyPartIndex = 0; BodyPartIndex < AOUUExampleCharacter::NumBodyParts; ++BodyPartIndex)
+	{
+		CrowdMemberColors[BodyPartIndex] =
+			BodyPartIndex < NumBodyPartColors ? BodyPartColors[BodyPartIndex] : EOUUExampleBodyPartColor::Red;
+	}
+
+	Crowd->Members.Add(CrowdMember);
+	return OUU::CodingStandard::Private::ToCrowdMemberHandle(CrowdMember);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::ResetCrowd()
+{
+	// Reset first, so listeners of the released characters see a consistent crowd.
+	TArray<TPair<FMassEntityHandle, TWeakObjectPtr<AOUUExampleCharacter>>> PromotedCharacters;
+	if (FMassEntityManager* EntityManager = GetEntityManager())
+	{
+		for (const FMassEntityHandle CrowdMember : Crowd->Members)
+		{
+			if (!EntityManager->IsEntityValid(CrowdMember))
+				continue;
+
+			PromotedCharacters.Emplace(
+				CrowdMember,
+				EntityManager->GetFragmentDataChecked<FOUUExampleCrowdCharacterFragment>(CrowdMember).Character);
+			EntityManager->DestroyEntity(CrowdMember);
+		}
+	}
+	Crowd->Members.Reset();
+
+	for (const auto& PromotedCharacter : PromotedCharacters)
+	{
+		// Listeners of earlier releases may have released and reacquired the character for something else.
+		auto* Character = PromotedCharacter.Value.Get();
+		const FOUUExampleCrowdMemberHandle CrowdMember =
+			OUU::CodingStandard::Private::ToCrowdMemberHandle(PromotedCharacter.Key);
+		if (Character && Character->CrowdMember == CrowdMember)
+		{
+			ReleaseCharacter(*Character);
+		}
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int32 UOUUExampleCharacterSubsystem::GetNumCrowdMembers() const
+{
+	return Crowd->Members.Num();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+AOUUExampleCharacter* UOUUExampleCharacterSubsystem::GetPromotedCrowdCharacter(
+	FOUUExampleCrowdMemberHandle CrowdMember) const
+{
+	const FMassEntityHandle Entity = OUU::CodingStandard::Private::ToEntityHandle(CrowdMember);
+	const FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager || !EntityManager->IsEntityValid(Entity))
+		return nullptr;
+
+	return EntityManager->GetFragmentDataChecked<FOUUExampleCrowdCharacterFragment>(Entity).Character.Get();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::UpdateCrowdAwesomenessLevels()
+{
+	LastCrowdMinAwesomeness = OUU::CodingStandard::Private::GetMinAwesomeness();
+
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager || !CrowdAwesomenessProcessor)
+		return;
+
+	// Levels of promoted crowd members are stale until they are demoted, because their actors own the data.
+	FMassProcessingContext ProcessingContext(*EntityManager, 0.f);
+	UE::Mass::Executor::Run(*CrowdAwesomenessProcessor, ProcessingContext);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::SetCrowdCharacterClass(TSubclassOf<AOUUExampleCharacter> CharacterClass)
+{
+	CrowdCharacterClass = CharacterClass;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+AOUUExampleCharacter* UOUUExampleCharacterSubsystem::AcquireCharacter(
+	TSubclassOf<AOUUExampleCharacter> CharacterClass,
+	const FTransform& Transform)
+{
+	const UClass* ExactClass = CharacterClass ? CharacterClass.Get() : AOUUExampleCharacter::StaticClass();
+	for (int32 Index = PooledCharacters.Num() - 1; Index >= 0; --Index)
+	{
+		AOUUExampleCharacter* Character = PooledCharacters[Index];
+		if (!IsValid(Character))
+		{
+			// Destroyed while pooled, e.g. by a level unload.
+			PooledCharacters.RemoveAtSwap(Index);
+			continue;
+		}
+
+		if (Character->GetClass() != ExactClass)
+			continue;
+
+		PooledCharacters.RemoveAtSwap(Index);
+		Character->ActivateFromPool(Transform);
+		return Character;
+	}
+
+	INC_DWORD_STAT(STAT_OUUCodingStandard_CharacterPoolMisses);
+	return SpawnCharacter(CharacterClass, Transform);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::ReleaseCharacter(AOUUExampleCharacter& Character)
+{
+	// Pooled characters are not destroyed, so the crowd can't detect the release via its weak pointer. It must stop
+	// referencing the character before anybody else can reacquire it from the pool.
+	if (Character.CrowdMember)
+	{
+		UnlinkCrowdCharacter(Character);
+	}
+
+	if (Character.IsActorBeingDestroyed())
+		return;
+
+	if (!ensureMsgf(
+			!PooledCharacters.Contains(&Character),
+			TEXT("%s - Character was already released"),
+			*Character.GetName()))
+	{
+		return;
+	}
+
+	if (PooledCharacters.Num() >= OUU::CodingStandard::Private::CVar_CharacterPoolMaxSize.GetValueOnGameThread())
+	{
+		Character.Destroy();
+		return;
+	}
+
+	Character.ResetForPool();
+	PooledCharacters.Add(&Character);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::PrewarmCharacterPool(
+	TSubclassOf<AOUUExampleCharacter> CharacterClass,
+	int32 NumCharacters)
+{
+	for (int32 Index = 0; Index < NumCharacters; ++Index)
+	{
+		if (auto* Character = SpawnCharacter(CharacterClass, FTransform::Identity))
+		{
+			ReleaseCharacter(*Character);
+		}
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int32 UOUUExampleCharacterSubsystem::GetNumPooledCharacters() const
+{
+	return PooledCharacters.Num();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::QueueDeferredAwesomenessChanged(AOUUExampleCharacter& Character)
+{
+	CharactersWithDeferredAwesomenessChanges.Add(&Character);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::QueueMulticastData(AOUUExampleCharacter& Character)
+{
+	CharactersWithQueuedMulticastData.Add(&Character);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::QueuePendingServerData(AOUUExampleCharacter& Character)
+{
+	CharactersWithPendingServerData.Add(&Character);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Collection.InitializeDependency(UMassEntitySubsystem::StaticClass());
+	CrowdAwesomenessProcessor = NewObject<UOUUExampleCrowdAwesomenessProcessor>(this);
+	CrowdAwesomenessProcessor->CallInitialize(this);
+	Crowd = MakePimpl<FOUUExampleCrowd>();
+	Crowd->LODQuery.AddRequirement<FOUUExampleCrowdLocationFragment>(EMassFragmentAccess::ReadOnly);
+	Crowd->LODQuery.AddRequirement<FOUUExampleCrowdCharacterFragment>(EMassFragmentAccess::ReadWrite);
+
+	WorldPostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(
+		this,
+		&UOUUExampleCharacterSubsystem::HandleWorldPostActorTick);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(WorldPostActorTickHandle);
+	WorldPostActorTickHandle.Reset();
+
+	Super::Deinitialize();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	const bool bBatchMulticastRPCs = OUU::CodingStandard::Private::CVar_BatchMulticastRPCs.GetValueOnGameThread();
+	if (InWorld.GetNetMode() == NM_Client || !bBatchMulticastRPCs)
+		return;
+
+	SpawnRPCBatcher(InWorld);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool UOUUExampleCharacterSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Characters only play in game worlds. Editor and preview worlds don't need the registry or the end of frame work.
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World != GetWorld())
+		return;
+
+	TArray<FTransform, TInlineAllocator<4>> PlayerViewpoints;
+	GetPlayerViewpoints(PlayerViewpoints);
+	UpdateCrowd(PlayerViewpoints);
+	UpdateSignificance(PlayerViewpoints);
+
+	// Levels only change without a SetAwesomeness() call if the threshold changed.
+	const int32 MinAwesomeness = OUU::CodingStandard::Private::GetMinAwesomeness();
+	if (!LastMinAwesomeness.IsSet() || LastMinAwesomeness.GetValue() != MinAwesomeness)
+	{
+		UpdateAwesomenessLevels();
+	}
+
+	FlushDeferredAwesomenessChanges();
+	FlushMulticastData();
+	FlushPendingServerData();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::FlushDeferredAwesomenessChanges()
+{
+	// Listeners may change awesomeness again while we flush, which queues the character for the next frame.
+	const auto CharactersToFlush = MoveTemp(CharactersWithDeferredAwesomenessChanges);
+	CharactersWithDeferredAwesomenessChanges.Reset();
+	const double CurrentTime = GetWorld()->GetTimeSeconds();
+	for (const auto& WeakCharacter : CharactersToFlush)
+	{
+		auto* Character = WeakCharacter.Get();
+		if (!Character)
+			continue;
+
+		// Less significant characters keep their changes queued until the interval of their bucket passed.
+		if (Character->IsDeferredAwesomenessFlushDue(CurrentTime))
+		{
+			Character->FlushDeferredAwesomenessChanged();
+		}
+		else
+		{
+			CharactersWithDeferredAwesomenessChanges.Add(WeakCharacter);
+		}
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::FlushMulticastData()
+{
+	if (CharactersWithQueuedMulticastData.Num() == 0)
+		return;
+
+	TArray<AOUUExampleCharacter*> Senders;
+	Senders.Reserve(CharactersWithQueuedMulticastData.Num());
+	for (const auto& WeakCharacter : CharactersWithQueuedMulticastData)
+	{
+		if (auto* Character = WeakCharacter.Get())
+		{
+			Senders.Add(Character);
+		}
+	}
+	CharactersWithQueuedMulticastData.Reset();
+
+	if (Senders.Num() == 0)
+		return;
+
+	// Batching was enabled after the world began play, so clients don't have a channel for the batcher yet.
+	// This frame's data is still sent per character, so it's not dropped while the channel opens.
+	UWorld* World = GetWorld();
+	if (!RPCBatcher && World->HasBegunPlay() && World->GetNetMode() != NM_Client)
+	{
+		SpawnRPCBatcher(*World);
+		for (auto* Sender : Senders)
+		{
+			Sender->Multicast_SendDataToEveryone();
+		}
+		return;
+	}
+
+	// Data queued before the world began play, or after the batcher failed to spawn, is sent per character.
+	if (!RPCBatcher)
+	{
+		for (auto* Sender : Senders)
+		{
+			Sender->Multicast_SendDataToEveryone();
+		}
+		return;
+	}
+
+	RPCBatcher->Multicast_SendBatchedDataToEveryone(Senders);
+	INC_DWORD_STAT_BY(STAT_OUUCodingStandard_SavedMulticastRPCs, Senders.Num() - 1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::FlushPendingServerData()
+{
+	for (const auto& WeakCharacter : CharactersWithPendingServerData)
+	{
+		if (auto* Character = WeakCharacter.Get())
+		{
+			Character->FlushPendingServerData();
+		}
+	}
+	CharactersWithPendingServerData.Reset();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::SpawnRPCBatcher(UWorld& InWorld)
+{
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.ObjectFlags |= RF_Transient;
+	RPCBatcher = InWorld.SpawnActor<AOUUExampleCharacterRPCBatcher>(SpawnParameters);
+	ensureMsgf(RPCBatcher, TEXT("Failed to spawn multicast RPC batcher"));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+AOUUExampleCharacter* UOUUExampleCharacterSubsystem::SpawnCharacter(
+	TSubclassOf<AOUUExampleCharacter> CharacterClass,
+	const FTransform& Transform)
+{
+	UClass* SpawnClass = CharacterClass ? CharacterClass.Get() : AOUUExampleCharacter::StaticClass();
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+	auto* Character = GetWorld()->SpawnActor<AOUUExampleCharacter>(SpawnClass, Transform, SpawnParameters);
+	ensureMsgf(Character, TEXT("Failed to spawn character of class %s"), *GetNameSafe(SpawnClass));
+	return Character;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::GetPlayerViewpoints(TArray<FTransform, TInlineAllocator<4>>& OutViewpoints) const
+{
+	for (auto Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		if (const APlayerController* PlayerController = Iterator->Get())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			OutViewpoints.Emplace(ViewRotation, ViewLocation);
+		}
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::UpdateSignificance(TConstArrayView<FTransform> PlayerViewpoints)
+{
+	auto* SignificanceManager = USignificanceManager::Get(GetWorld());
+	if (SignificanceManager && OUU::CodingStandard::Private::CVar_UpdateSignificanceManager.GetValueOnGameThread())
+	{
+		SignificanceManager->Update(PlayerViewpoints);
+	}
+
+	const auto NumCharactersBySignificance = CountCharactersBySignificance();
+	SET_DWORD_STAT(STAT_OUUCodingStandard_NumHighSignificanceCharacters, NumCharactersBySignificance[0]);
+	SET_DWORD_STAT(STAT_OUUCodingStandard_NumMediumSignificanceCharacters, NumCharactersBySignificance[1]);
+	SET_DWORD_STAT(STAT_OUUCodingStandard_NumLowSignificanceCharacters, NumCharactersBySignificance[2]);
+	SET_DWORD_STAT(STAT_OUUCodingStandard_NumLowestSignificanceCharacters, NumCharactersBySignificance[3]);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+FMassEntityManager* UOUUExampleCharacterSubsystem::GetEntityManager() const
+{
+	auto* EntitySubsystem = GetWorld()->GetSubsystem<UMassEntitySubsystem>();
+	return EntitySubsystem ? &EntitySubsystem->GetMutableEntityManager() : nullptr;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::UpdateCrowd(TConstArrayView<FTransform> PlayerViewpoints)
+{
+	SCOPE_CYCLE_COUNTER(STAT_OUUCodingStandard_UpdateCrowd);
+	using namespace OUU::CodingStandard::Private;
+
+	const int32 NumCrowdMembers = GetNumCrowdMembers();
+	SET_DWORD_STAT(STAT_OUUCodingStandard_NumCrowdMembers, NumCrowdMembers);
+
+	// Crowds are only simulated on the server. Clients receive the promoted characters via replication.
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (NumCrowdMembers == 0 || !EntityManager || GetWorld()->GetNetMode() == NM_Client)
+		return;
+
+	const int32 MinAwesomeness = GetMinAwesomeness();
+	if (!LastCrowdMinAwesomeness.IsSet() || LastCrowdMinAwesomeness.GetValue() != MinAwesomeness)
+	{
+		UpdateCrowdAwesomenessLevels();
+	}
+
+	const float PromotionDistance = CVar_CrowdPromotionDistance.GetValueOnGameThread();
+	const float DemotionDistance = FMath::Max(PromotionDistance, CVar_CrowdDemotionDistance.GetValueOnGameThread());
+	const float PromotionDistanceSquared = FMath::Square(PromotionDistance);
+	const float DemotionDistanceSquared = FMath::Square(DemotionDistance);
+	int32 NumPromotedCrowdMembers = 0;
+	Crowd->MembersToPromote.Reset();
+	Crowd->MembersToDemote.Reset();
+
+	FMassExecutionContext ExecutionContext(*EntityManager);
+	Crowd->LODQuery.ForEachEntityChunk(*EntityManager, ExecutionContext, [&](FMassExecutionContext& ChunkContext) {
+		const auto LocationList = ChunkContext.GetFragmentView<FOUUExampleCrowdLocationFragment>();
+		const auto CharacterList = ChunkContext.GetMutableFragmentView<FOUUExampleCrowdCharacterFragment>();
+		for (int32 Index = 0; Index < ChunkContext.GetNumEntities(); ++Index)
+		{
+			auto& WeakCharacter = CharacterList[Index].Character;
+			if (!WeakCharacter.IsExplicitlyNull() && !WeakCharacter.IsValid())
+			{
+				// The actor was destroyed externally. The crowd member keeps the last known data.
+				WeakCharacter.Reset();
+			}
+
+			// The larger demotion distance prevents crowd members at the border from flipping every frame.
+			const bool bIsPromoted = WeakCharacter.IsValid();
+			const float MaxDistanceSquared = bIsPromoted ? DemotionDistanceSquared : PromotionDistanceSquared;
+			bool bIsNearViewer = false;
+			for (const FTransform& Viewpoint : PlayerViewpoints)
+			{
+				const FVector& Location = LocationList[Index].Location;
+				bIsNearViewer |= FVector::DistSquared(Viewpoint.GetLocation(), Location) <= MaxDistanceSquared;
+			}
+
+			if (bIsNearViewer == bIsPromoted)
+			{
+				NumPromotedCrowdMembers += bIsPromoted ? 1 : 0;
+			}
+			else if (bIsPromoted)
+			{
+				Crowd->MembersToDemote.Add(ChunkContext.GetEntity(Index));
+			}
+			else
+			{
+				Crowd->MembersToPromote.Add(ChunkContext.GetEntity(Index));
+			}
+		}
+	});
+
+	// Promoting and demoting spawns and releases actors, which must not happen while the query iterates the chunks.
+	for (const FMassEntityHandle CrowdMember : Crowd->MembersToDemote)
+	{
+		DemoteCrowdMember(CrowdMember);
+	}
+
+	const int32 MaxPromotionsPerFrame = CVar_CrowdMaxPromotionsPerFrame.GetValueOnGameThread();
+	const int32 NumPromotions = FMath::Clamp(MaxPromotionsPerFrame, 0, Crowd->MembersToPromote.Num());
+	for (int32 Index = 0; Index < NumPromotions; ++Index)
+	{
+		PromoteCrowdMember(Crowd->MembersToPromote[Index]);
+	}
+	SET_DWORD_STAT(STAT_OUUCodingStandard_NumPromotedCrowdMembers, NumPromotedCrowdMembers + NumPromotions);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::PromoteCrowdMember(FMassEntityHandle CrowdMember)
+{
+	// Listeners of released or spawned characters may reset the crowd, so the entity is checked before each access.
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager || !EntityManager->IsEntityValid(CrowdMember))
+		return;
+
+	// Copy the data before acquiring the character, because BeginPlay listeners may modify the crowd.
+	const FVector Location =
+		EntityManager->GetFragmentDataChecked<FOUUExampleCrowdLocationFragment>(CrowdMember).Location;
+	const int32 Awesomeness =
+		EntityManager->GetFragmentDataChecked<FOUUExampleAwesomenessFragment>(CrowdMember).Awesomeness;
+	const auto BodyPartColors = EntityManager->GetFragmentDataChecked<FOUUExampleBodyPartColorsFragment>(CrowdMember);
+
+	auto* Character = AcquireCharacter(CrowdCharacterClass, FTransform(Location));
+	if (!Character)
+		return;
+
+	if (!EntityManager->IsEntityValid(CrowdMember))
+	{
+		// The crowd was reset while the character was spawned.
+		ReleaseCharacter(*Character);
+		return;
+	}
+
+	EntityManager->GetFragmentDataChecked<FOUUExampleCrowdCharacterFragment>(CrowdMember).Character = Character;
+	Character->CrowdMember = OUU::CodingStandard::Private::ToCrowdMemberHandle(CrowdMember);
+
+	Character->SetAwesomeness(Awesomeness);
+	for (int32 BodyPartIndex = 0; BodyPartIndex < AOUUExampleCharacter::NumBodyParts; ++BodyPartIndex)
+	{
+		Character->ColorBodyPartByIndex(BodyPartIndex, BodyPartColors.BodyPartColors[BodyPartIndex]);
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::DemoteCrowdMember(FMassEntityHandle CrowdMember)
+{
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager || !EntityManager->IsEntityValid(CrowdMember))
+		return;
+
+	auto& WeakCharacter =
+		EntityManager->GetFragmentDataChecked<FOUUExampleCrowdCharacterFragment>(CrowdMember).Character;
+	auto* Character = WeakCharacter.Get();
+	if (!Character)
+	{
+		WeakCharacter.Reset();
+		return;
+	}
+
+	// Releasing copies the data of the character back to the crowd member.
+	ReleaseCharacter(*Character);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void UOUUExampleCharacterSubsystem::UnlinkCrowdCharacter(AOUUExampleCharacter& Character)
+{
+	const FMassEntityHandle CrowdMember = OUU::CodingStandard::Private::ToEntityHandle(Character.CrowdMember);
+	Character.CrowdMember = FOUUExampleCrowdMemberHandle();
+
+	// The entity is already gone if the crowd was reset.
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager || !EntityManager->IsEntityValid(CrowdMember))
+		return;
+
+	auto& WeakCharacter =
+		EntityManager->GetFragmentDataChecked<FOUUExampleCrowdCharacterFragment>(CrowdMember).Character;
+	if (!ensureMsgf(
+			WeakCharacter.Get() == &Character,
+			TEXT("%s - Character is not the promoted actor of its crowd member"),
+			*Character.GetName()))
+	{
+		return;
+	}
+	WeakCharacter.Reset();
+
+	EntityManager->GetFragmentDataChecked<FOUUExampleCrowdLocationFragment>(CrowdMember).Location =
+		Character.GetActorLocation();
+	EntityManager->GetFragmentDataChecked<FOUUExampleAwesomenessFragment>(CrowdMember).Awesomeness =
+		Character.GetAwesomeness();
+	EntityManager->GetFragmentDataChecked<FOUUExampleAwesomenessLevelFragment>(CrowdMember).AwesomenessLevel =
+		Character.GetAwesomenessLevel();
+	auto& BodyPartColors =
+		EntityManager->GetFragmentDataChecked<FOUUExampleBodyPartColorsFragment>(CrowdMember).BodyPartColors;
+	for (int32 BodyPartIndex = 0; BodyPartIndex < AOUUExampleCharacter::NumBodyParts; ++BodyPartIndex)
+	{
+		BodyPartColors[BodyPartIndex] = Character.GetBodyPartColor(BodyPartIndex);
+	}
 }
@@ -0,0 +1,125 @@
+// Copyright (c) 2022 Jonas Reich
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "MassEntityQuery.h"
+#include "MassEntityTypes.h"
+#include "MassProcessor.h"
+#include "OUUCodingStandard.h"
+
+#include "OUUCodingStandardCrowd.generated.h"
+
+// Mass types are only used by the implementation of UOUUExampleCharacterSubsystem, so they are declared in this private
+// header. Modules that include OUUCodingStandard.h only see FOUUExampleCrowdMemberHandle and don't depend on Mass.
+// -> see [build.cs.dep]
+
+//---------------------------------------------------------------------------------------------------------------------
+// [mass.fragment] Mass fragments are plain data that is stored in chunks of entities with the same archetype.
+// Split data by access pattern, so processors only touch the memory they need, and keep fragments trivially copyable.
+
+// Location of an actor-less crowd member.
+USTRUCT()
+struct FOUUExampleCrowdLocationFragment : public FMassFragment
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FVector Location = FVector::ZeroVector;
+};
+
+// Numeric awesomeness of a crowd member -> see OUU::CodingStandard::FNumericAwesomeness
+USTRUCT()
+struct FOUUExampleAwesomenessFragment : public FMassFragment
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	int32 Awesomeness = 0;
+};
+
+// Awesomeness level of a crowd member, evaluated from FOUUExampleAwesomenessFragment.
+USTRUCT()
+struct FOUUExampleAwesomenessLevelFragment : public FMassFragment
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	EAwesomenessLevel AwesomenessLevel = EAwesomenessLevel::NotAwesome;
+};
+
+USTRUCT()
+struct FOUUExampleBodyPartColorsFragment : public FMassFragment
+{
+	GENERATED_BODY()
+public:
+	// Color of each body part, indexed by body part index.
+	UPROPERTY()
+	EOUUExampleBodyPartColor BodyPartColors[AOUUExampleCharacter::NumBodyParts] = {};
+};
+
+// Link between a crowd member entity and the actor that represents it while it's promoted.
+USTRUCT()
+struct FOUUExampleCrowdCharacterFragment : public FMassFragment
+{
+	GENERATED_BODY()
+public:
+	// Only set while the crowd member is promoted. The actor owns the crowd member data until it's demoted again.
+	TWeakObjectPtr<AOUUExampleCharacter> Character;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Evaluates the awesomeness levels of crowd members chunk by chunk with the vectorized batch conversion.
+ * Not registered with the processing phases: UOUUExampleCharacterSubsystem runs it whenever the threshold changed,
+ * because the levels can't change otherwise.
+ */
+UCLASS()
+class UOUUExampleCrowdAwesomenessProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+public:
+	UOUUExampleCrowdAwesomenessProcessor();
+
+protected:
+	// -- UMassProcessor interface
+	void ConfigureQueries() override;
+	void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Mass entities and queries of the crowd of a UOUUExampleCharacterSubsystem.
+ */
+struct FOUUExampleCrowd
+{
+	// Entities of all crowd members in the order they were added.
+	TArray<FMassEntityHandle> Members;
+
+	// Archetype of all crowd member entities. Created when the first crowd member is added.
+	FMassArchetypeHandle Archetype;
+
+	// Visits the location and actor link of every crowd member to decide which ones are promoted or demoted.
+	FMassEntityQuery LODQuery;
+
+	// Scratch buffers for UOUUExampleCharacterSubsystem::UpdateCrowd() that are kept to avoid allocations.
+	TArray<FMassEntityHandle> MembersToPromote;
+	TArray<FMassEntityHandle> MembersToDemote;
+};
+
+namespace OUU::CodingStandard::Private
+{
+	inline FMassEntityHandle ToEntityHandle(FOUUExampleCrowdMemberHandle CrowdMember)
+	{
+		return FMassEntityHandle(CrowdMember.Index, CrowdMember.SerialNumber);
+	}
+
+	inline FOUUExampleCrowdMemberHandle ToCrowdMemberHandle(FMassEntityHandle Entity)
+	{
+		return FOUUExampleCrowdMemberHandle(Entity.Index, Entity.SerialNumber);
+	}
+} // namespace OUU::CodingStandard::Private
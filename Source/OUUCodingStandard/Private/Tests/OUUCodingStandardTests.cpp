@@ -0,0 +1,2284 @@
+// Copyright (c) 2022 Jonas Reich
+
+// [test.files] Automation tests live in the Private/Tests directory of the module they test.
+// Guard them with WITH_DEV_AUTOMATION_TESTS, so they are compiled out of shipping builds.
+
+#include "OUUCodingStandard.h"
+
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "MassEntitySubsystem.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "OUUCodingStandardCrowd.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace OUU::CodingStandard::Tests
+{
+	// [test.naming] Test names start with the module name followed by the feature, so they are grouped in the session
+	// frontend.
+	constexpr auto TestFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext
+		| EAutomationTestFlags::ServerContext | EAutomationTestFlags::ProductFilter;
+
+	// [test.perf] Performance tests only report their measurements and never fail because of timings, which depend on
+	// the machine. They are suffixed with '.Performance' and use the perf filter, so they don't slow down regular runs.
+	constexpr auto PerfTestFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext
+		| EAutomationTestFlags::ServerContext | EAutomationTestFlags::PerfFilter;
+
+	/**
+	 * Call a function repeatedly inside a named event scope, so the measurement can also be inspected in Insights.
+	 * @returns		the average duration of a single call in seconds.
+	 */
+	template <typename FunctionType>
+	double MeasureAverageSeconds(const TCHAR* Name, int32 NumIterations, FunctionType&& Function)
+	{
+		SCOPED_NAMED_EVENT_TCHAR(Name, FColor::Turquoise);
+		const double StartSeconds = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			Function();
+		}
+		return (FPlatformTime::Seconds() - StartSeconds) / NumIterations;
+	}
+
+	/**
+	 * Counts the heap allocations made by the current thread while it's installed in place of GMalloc.
+	 * Everything is forwarded to the original allocator, so memory can be freed after it's uninstalled.
+	 * Other threads may still be inside the proxy after it was uninstalled, so only a single static instance exists.
+	 */
+	class FAllocationCountingMalloc : public FMalloc
+	{
+	public:
+		static FAllocationCountingMalloc& Get();
+
+		void Install();
+		void Uninstall();
+
+		// @returns	the number of allocations the installing thread made since Install() was called.
+		int32 GetNumAllocations() const;
+
+		// - FMalloc
+		void* Malloc(SIZE_T Count, uint32 Alignment) override;
+		void* TryMalloc(SIZE_T Count, uint32 Alignment) override;
+		void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override;
+		void Free(void* Original) override;
+		SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override;
+		bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override;
+		void Trim(bool bTrimThreadCaches) override;
+		void SetupTLSCachesOnCurrentThread() override;
+		void ClearAndDisableTLSCachesOnCurrentThread() override;
+		bool IsInternallyThreadSafe() const override;
+		const TCHAR* GetDescriptiveName() override;
+		// --
+
+	private:
+		FMalloc* InnerMalloc = nullptr;
+		uint32 CountingThreadId = 0;
+		int32 NumAllocations = 0;
+
+		void CountAllocation();
+	};
+
+	/**
+	 * Counts the heap allocations of the current thread for the lifetime of this object.
+	 */
+	class FScopedAllocationCounter
+	{
+	public:
+		FScopedAllocationCounter();
+		~FScopedAllocationCounter();
+		UE_NONCOPYABLE(FScopedAllocationCounter);
+
+		// @returns	the number of allocations since construction, excluding the allocation of the sanity check.
+		int32 GetNumAllocations() const;
+
+		// @returns	false if allocations bypass GMalloc in this build, so none of them can be counted.
+		bool CanCountAllocations() const;
+
+	private:
+		bool bCanCountAllocations = false;
+	};
+
+	inline FAllocationCountingMalloc& FAllocationCountingMalloc::Get()
+	{
+		static FAllocationCountingMalloc Instance;
+		return Instance;
+	}
+
+	inline void FAllocationCountingMalloc::Install()
+	{
+		check(GMalloc != this);
+		InnerMalloc = GMalloc;
+		CountingThreadId = FPlatformTLS::GetCurrentThreadId();
+		NumAllocations = 0;
+		GMalloc = this;
+	}
+
+	inline void FAllocationCountingMalloc::Uninstall()
+	{
+		check(GMalloc == this);
+		GMalloc = InnerMalloc;
+	}
+
+	inline int32 FAllocationCountingMalloc::GetNumAllocations() const
+	{
+		return NumAllocations;
+	}
+
+	inline void* FAllocationCountingMalloc::Malloc(SIZE_T Count, uint32 Alignment)
+	{
+		CountAllocation();
+		return InnerMalloc->Malloc(Count, Alignment);
+	}
+
+	inline void* FAllocationCountingMalloc::TryMalloc(SIZE_T Count, uint32 Alignment)
+	{
+		CountAllocation();
+		return InnerMalloc->TryMalloc(Count, Alignment);
+	}
+
+	inline void* FAllocationCountingMalloc::Realloc(void* Original, SIZE_T Count, uint32 Alignment)
+	{
+		// Shrinking to zero is a free, everything else may move the memory.
+		if (Count > 0)
+		{
+			CountAllocation();
+		}
+		return InnerMalloc->Realloc(Original, Count, Alignment);
+	}
+
+	inline void FAllocationCountingMalloc::Free(void* Original)
+	{
+		InnerMalloc->Free(Original);
+	}
+
+	inline SIZE_T FAllocationCountingMalloc::QuantizeSize(SIZE_T Count, uint32 Alignment)
+	{
+		return InnerMalloc->QuantizeSize(Count, Alignment);
+	}
+
+	inline bool FAllocationCountingMalloc::GetAllocationSize(void* Original, SIZE_T& SizeOut)
+	{
+		return InnerMalloc->GetAllocationSize(Original, SizeOut);
+	}
+
+	inline void FAllocationCountingMalloc::Trim(bool bTrimThreadCaches)
+	{
+		InnerMalloc->Trim(bTrimThreadCaches);
+	}
+
+	inline void FAllocationCountingMalloc::SetupTLSCachesOnCurrentThread()
+	{
+		InnerMalloc->SetupTLSCachesOnCurrentThread();
+	}
+
+	inline void FAllocationCountingMalloc::ClearAndDisableTLSCachesOnCurrentThread()
+	{
+		InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread();
+	}
+
+	inline bool FAllocationCountingMalloc::IsInternallyThreadSafe() const
+	{
+		return InnerMalloc->IsInternallyThreadSafe();
+	}
+
+	inline const TCHAR* FAllocationCountingMalloc::GetDescriptiveName()
+	{
+		return InnerMalloc->GetDescriptiveName();
+	}
+
+	inline void FAllocationCountingMalloc::CountAllocation()
+	{
+		if (FPlatformTLS::GetCurrentThreadId() == CountingThreadId)
+		{
+			++NumAllocations;
+		}
+	}
+
+	inline FScopedAllocationCounter::FScopedAllocationCounter()
+	{
+		FAllocationCountingMalloc::Get().Install();
+
+		FMemory::Free(FMemory::Malloc(1));
+		bCanCountAllocations = (FAllocationCountingMalloc::Get().GetNumAllocations() == 1);
+	}
+
+	inline FScopedAllocationCounter::~FScopedAllocationCounter()
+	{
+		FAllocationCountingMalloc::Get().Uninstall();
+	}
+
+	inline int32 FScopedAllocationCounter::GetNumAllocations() const
+	{
+		return FAllocationCountingMalloc::Get().GetNumAllocations() - (bCanCountAllocations ? 1 : 0);
+	}
+
+	inline bool FScopedAllocationCounter::CanCountAllocations() const
+	{
+		return bCanCountAllocations;
+	}
+	/**
+	 * Game world that only exists for the lifetime of this object.
+	 * All world subsystems are initialized and actors spawned into it receive BeginPlay.
+	 */
+	class FScopedTestWorld
+	{
+	public:
+		FScopedTestWorld();
+		~FScopedTestWorld();
+		UE_NONCOPYABLE(FScopedTestWorld);
+
+		UWorld& Get() const;
+
+		// Tick all actors and run the end of frame work of world subsystems.
+		void Tick(float DeltaSeconds = 1.f / 60.f) const;
+
+	private:
+		UWorld* World = nullptr;
+	};
+
+	inline FScopedTestWorld::FScopedTestWorld()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false);
+		GEngine->CreateNewWorldContext(EWorldType::Game).SetCurrentWorld(World);
+
+		const FURL URL;
+		World->SetGameMode(URL);
+		World->InitializeActorsForPlay(URL);
+		World->BeginPlay();
+	}
+
+	inline FScopedTestWorld::~FScopedTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	inline UWorld& FScopedTestWorld::Get() const
+	{
+		return *World;
+	}
+
+	inline void FScopedTestWorld::Tick(float DeltaSeconds) const
+	{
+		World->Tick(LEVELTICK_All, DeltaSeconds);
+	}
+
+	// Check the vectorized Find() against a linear search for every needle position, including tail elements that
+	// don't fill a whole vector and needles that are not contained at all.
+	template <typename ElementType>
+	bool TestVectorizedFind(FAutomationTestBase& Test, const TCHAR* TypeName)
+	{
+		using FContainer = Templates::TMyContainer<ElementType, FDefaultAllocator, 8>;
+
+		int32 NumMismatches = 0;
+		for (int32 NumElements = 0; NumElements <= 70; ++NumElements)
+		{
+			FContainer Container;
+			for (int32 Index = 0; Index < NumElements; ++Index)
+			{
+				// Duplicates make sure the first match is returned.
+				Container.Add(static_cast<ElementType>(Index % 37 + 1));
+			}
+
+			for (int32 Needle = 0; Needle <= 38; ++Needle)
+			{
+				const ElementType Item = static_cast<ElementType>(Needle);
+				int32 ExpectedIndex = INDEX_NONE;
+				for (int32 Index = 0; Index < NumElements && ExpectedIndex == INDEX_NONE; ++Index)
+				{
+					ExpectedIndex = (Container[Index] == Item) ? Index : INDEX_NONE;
+				}
+				NumMismatches += (Container.Find(Item) != ExpectedIndex) ? 1 : 0;
+			}
+		}
+		return Test.TestEqual(*FString::Printf(TEXT("Find mismatches for %s"), TypeName), NumMismatches, 0);
+	}
+} // namespace OUU::CodingStandard::Tests
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardMinAwesomenessPerfTest,
+	"OUUCodingStandard.Awesomeness.MinAwesomeness.Performance",
+	OUU::CodingStandard::Tests::PerfTestFlags)
+
+bool FOUUCodingStandardMinAwesomenessPerfTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	IConsoleVariable* MinAwesomenessCVar =
+		IConsoleManager::Get().FindConsoleVariable(TEXT("ouu.CodingStandard.MinAwesomeness"));
+	if (!TestNotNull(TEXT("MinAwesomeness cvar"), MinAwesomenessCVar))
+		return false;
+
+	// Same data the uncached code read via TAutoConsoleVariable<int32>::GetValueOnAnyThread().
+	TConsoleVariableData<int32>* MinAwesomenessCVarData = MinAwesomenessCVar->AsVariableInt();
+	if (!TestNotNull(TEXT("MinAwesomeness cvar data"), MinAwesomenessCVarData))
+		return false;
+
+	TestEqual(
+		TEXT("Cached threshold matches the cvar"),
+		UOUUExampleBlueprintFunctionLibrary::GetAwesomenessThreshold(),
+		MinAwesomenessCVar->GetInt());
+
+	// The sums keep the compiler from optimizing the reads away.
+	constexpr int32 NumReads = 1000000;
+	int64 CVarSum = 0;
+	int64 CachedSum = 0;
+	const double CVarSeconds = MeasureAverageSeconds(TEXT("Read MinAwesomeness cvar"), NumReads, [&]() {
+		CVarSum += MinAwesomenessCVarData->GetValueOnAnyThread();
+	});
+	const double CachedSeconds = MeasureAverageSeconds(TEXT("Read cached MinAwesomeness"), NumReads, [&]() {
+		CachedSum += UOUUExampleBlueprintFunctionLibrary::GetAwesomenessThreshold();
+	});
+	TestEqual(TEXT("Sum of cached reads"), CachedSum, CVarSum);
+
+	// Worker threads read the same values concurrently, so contention on the snapshot would show up here.
+	constexpr int32 NumWorkerChunks = 64;
+	constexpr int32 NumReadsPerChunk = NumReads / NumWorkerChunks;
+	std::atomic<int64> CVarWorkerSum{0};
+	const double CVarWorkerSeconds = MeasureAverageSeconds(TEXT("Read MinAwesomeness cvar on workers"), 1, [&]() {
+		ParallelFor(NumWorkerChunks, [&](int32 ChunkIndex) {
+			int64 ChunkSum = 0;
+			for (int32 Index = 0; Index < NumReadsPerChunk; ++Index)
+			{
+				ChunkSum += MinAwesomenessCVarData->GetValueOnAnyThread();
+			}
+			CVarWorkerSum += ChunkSum;
+		});
+	});
+	std::atomic<int64> WorkerSum{0};
+	const double WorkerSeconds = MeasureAverageSeconds(TEXT("Read cached MinAwesomeness on workers"), 1, [&]() {
+		ParallelFor(NumWorkerChunks, [&](int32 ChunkIndex) {
+			int64 ChunkSum = 0;
+			for (int32 Index = 0; Index < NumReadsPerChunk; ++Index)
+			{
+				ChunkSum += UOUUExampleBlueprintFunctionLibrary::GetAwesomenessThreshold();
+			}
+			WorkerSum += ChunkSum;
+		});
+	});
+	TestEqual(TEXT("Sum of cached reads on workers"), WorkerSum.load(), CVarWorkerSum.load());
+
+	AddInfo(FString::Printf(
+		TEXT("Per read: cvar %s, cached %s, on workers (wall time for all workers): cvar %s, cached %s"),
+		*FPlatformTime::PrettyTime(CVarSeconds),
+		*FPlatformTime::PrettyTime(CachedSeconds),
+		*FPlatformTime::PrettyTime(CVarWorkerSeconds / (NumWorkerChunks * NumReadsPerChunk)),
+		*FPlatformTime::PrettyTime(WorkerSeconds / (NumWorkerChunks * NumReadsPerChunk))));
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardAwesomenessLevelsFromIntValuesTest,
+	"OUUCodingStandard.Awesomeness.AwesomenessLevelsFromIntValues",
+	OUU::CodingStandard::Tests::TestFlags)
+
+bool FOUUCodingStandardAwesomenessLevelsFromIntValuesTest::RunTest(const FString& Parameters)
+{
+	const int32 MinAwesomeness = UOUUExampleBlueprintFunctionLibrary::GetAwesomenessThreshold();
+
+	// Values around every boundary of the conversion, followed by random values around the threshold.
+	TArray<int32> Awesomeness = {
+		MIN_int32,
+		-1,
+		0,
+		1,
+		MinAwesomeness - 1,
+		MinAwesomeness,
+		MinAwesomeness + 1,
+		MAX_int32};
+
+	// An odd count, so the batch has a remainder that doesn't fill a whole vector register.
+	const int32 RandomRange = 2 * FMath::Abs(MinAwesomeness) + 1;
+	FRandomStream RandomStream(42);
+	for (int32 Index = 0; Index < 1001; ++Index)
+	{
+		Awesomeness.Add(RandomStream.RandRange(-RandomRange, RandomRange));
+	}
+
+	TArray<EAwesomenessLevel> AwesomenessLevels;
+	AwesomenessLevels.SetNumUninitialized(Awesomeness.Num());
+	OUU::CodingStandard::AwesomenessLevelsFromIntValues(Awesomeness, AwesomenessLevels);
+
+	for (int32 Index = 0; Index < Awesomeness.Num(); ++Index)
+	{
+		const EAwesomenessLevel ExpectedLevel = OUU::CodingStandard::AwesomenessLevelFromIntValue(Awesomeness[Index]);
+		if (AwesomenessLevels[Index] != ExpectedLevel)
+		{
+			AddError(FString::Printf(
+				TEXT("Awesomeness %i: batch conversion returned %s, single conversion %s"),
+				Awesomeness[Index],
+				*OUU::CodingStandard::LexToString(AwesomenessLevels[Index]),
+				*OUU::CodingStandard::LexToString(ExpectedLevel)));
+		}
+	}
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardAwesomenessLevelsFromIntValuesPerfTest,
+	"OUUCodingStandard.Awesomeness.AwesomenessLevelsFromIntValues.Performance",
+	OUU::CodingStandard::Tests::PerfTestFlags)
+
+bool FOUUCodingStandardAwesomenessLevelsFromIntValuesPerfTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	constexpr int32 NumValues = 100000;
+	constexpr int32 NumIterations = 100;
+
+	TArray<int32> Awesomeness;
+	Awesomeness.Reserve(NumValues);
+	FRandomStream RandomStream(42);
+	for (int32 Index = 0; Index < NumValues; ++Index)
+	{
+		Awesomeness.Add(RandomStream.RandRange(-1000, 1000));
+	}
+
+	TArray<EAwesomenessLevel> ScalarLevels;
+	TArray<EAwesomenessLevel> BatchLevels;
+	ScalarLevels.SetNumUninitialized(NumValues);
+	BatchLevels.SetNumUninitialized(NumValues);
+
+	const double ScalarSeconds = MeasureAverageSeconds(TEXT("Convert awesomeness one by one"), NumIterations, [&]() {
+		for (int32 Index = 0; Index < NumValues; ++Index)
+		{
+			ScalarLevels[Index] = OUU::CodingStandard::AwesomenessLevelFromIntValue(Awesomeness[Index]);
+		}
+	});
+	const double BatchSeconds = MeasureAverageSeconds(TEXT("Convert awesomeness in batch"), NumIterations, [&]() {
+		OUU::CodingStandard::AwesomenessLevelsFromIntValues(Awesomeness, BatchLevels);
+	});
+
+	// Comparing the results also keeps the compiler from discarding either loop.
+	TestTrue(TEXT("Batch and scalar conversion produce the same levels"), ScalarLevels == BatchLevels);
+
+	AddInfo(FString::Printf(
+		TEXT("%i values: one by one %s, batch %s (%.2fx)"),
+		NumValues,
+		*FPlatformTime::PrettyTime(ScalarSeconds),
+		*FPlatformTime::PrettyTime(BatchSeconds),
+		ScalarSeconds / FMath::Max(BatchSeconds, UE_SMALL_NUMBER)));
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardAwesomenessLevelStringTest,
+	"OUUCodingStandard.Awesomeness.LexToString",
+	OUU::CodingStandard::Tests::TestFlags)
+
+bool FOUUCodingStandardAwesomenessLevelStringTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard;
+
+	for (int32 Index = 0; Index < static_cast<int32>(EAwesomenessLevel::NumOf); ++Index)
+	{
+		const EAwesomenessLevel AwesomenessLevel = static_cast<EAwesomenessLevel>(Index);
+		const FString Name = LexToString(AwesomenessLevel);
+		TestTrue(TEXT("LexToString matches LexToStringView"), LexToStringView(AwesomenessLevel).Equals(Name));
+
+		EAwesomenessLevel ParsedLevel = EAwesomenessLevel::NumOf;
+		TestTrue(TEXT("Name can be parsed"), TryLexFromString(ParsedLevel, Name));
+		TestTrue(TEXT("Name is parsed to the original level"), ParsedLevel == AwesomenessLevel);
+	}
+
+	TestEqual(TEXT("Name of NumOf"), LexToString(EAwesomenessLevel::NumOf), TEXT("<invalid>"));
+	TestEqual(TEXT("Name of out of range level"), LexToString(static_cast<EAwesomenessLevel>(-1)), TEXT("<invalid>"));
+
+	EAwesomenessLevel ParsedLevel = EAwesomenessLevel::NumOf;
+	TestFalse(TEXT("NumOf can be parsed"), TryLexFromString(ParsedLevel, TEXT("NumOf")));
+	TestFalse(TEXT("<invalid> can be parsed"), TryLexFromString(ParsedLevel, TEXT("<invalid>")));
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardAwesomenessLevelStringPerfTest,
+	"OUUCodingStandard.Awesomeness.LexToString.Performance",
+	OUU::CodingStandard::Tests::PerfTestFlags)
+
+bool FOUUCodingStandardAwesomenessLevelStringPerfTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard;
+	using namespace OUU::CodingStandard::Tests;
+
+	constexpr int32 NumConversions = 100000;
+	const auto GetAwesomenessLevel = [](int32 Index) {
+		return static_cast<EAwesomenessLevel>(Index % static_cast<int32>(EAwesomenessLevel::NumOf));
+	};
+
+	// The summed lengths keep the compiler from optimizing the conversions away.
+	int32 NumStringAllocations = 0;
+	int32 NumViewAllocations = 0;
+	int64 StringLengths = 0;
+	int64 ViewLengths = 0;
+	double StringSeconds = 0.0;
+	double ViewSeconds = 0.0;
+	{
+		FScopedAllocationCounter AllocationCounter;
+		if (!AllocationCounter.CanCountAllocations())
+		{
+			AddWarning(TEXT("Allocations bypass GMalloc in this build and can't be counted"));
+		}
+
+		int32 Index = 0;
+		StringSeconds = MeasureAverageSeconds(TEXT("LexToString"), NumConversions, [&]() {
+			StringLengths += LexToString(GetAwesomenessLevel(Index++)).Len();
+		});
+		NumStringAllocations = AllocationCounter.GetNumAllocations();
+
+		Index = 0;
+		ViewSeconds = MeasureAverageSeconds(TEXT("LexToStringView"), NumConversions, [&]() {
+			ViewLengths += LexToStringView(GetAwesomenessLevel(Index++)).Len();
+		});
+		NumViewAllocations = AllocationCounter.GetNumAllocations() - NumStringAllocations;
+	}
+
+	TestEqual(TEXT("Summed lengths"), ViewLengths, StringLengths);
+	TestEqual(TEXT("Allocations of LexToStringView"), NumViewAllocations, 0);
+
+	AddInfo(FString::Printf(
+		TEXT("Per conversion: LexToString %s with %.2f allocations, LexToStringView %s with %.2f allocations"),
+		*FPlatformTime::PrettyTime(StringSeconds),
+		static_cast<double>(NumStringAllocations) / NumConversions,
+		*FPlatformTime::PrettyTime(ViewSeconds),
+		static_cast<double>(NumViewAllocations) / NumConversions));
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardAwesomenessLevelParsePerfTest,
+	"OUUCodingStandard.Awesomeness.TryLexFromString.Performance",
+	OUU::CodingStandard::Tests::PerfTestFlags)
+
+bool FOUUCodingStandardAwesomenessLevelParsePerfTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard;
+	using namespace OUU::CodingStandard::Tests;
+
+	// Corpus of valid names with random casing and some invalid ones, like a config import would contain.
+	constexpr int32 NumNames = 100000;
+	const FStringView InvalidNames[] = {TEXTVIEW("NumOf"), TEXTVIEW("Awesomer"), TEXTVIEW("")};
+	FRandomStream RandomStream(42);
+	TArray<FString> Corpus;
+	Corpus.Reserve(NumNames);
+	for (int32 Index = 0; Index < NumNames; ++Index)
+	{
+		const int32 NameIndex = RandomStream.RandHelper(static_cast<int32>(EAwesomenessLevel::NumOf) + 1);
+		FString Name(
+			NameIndex < static_cast<int32>(EAwesomenessLevel::NumOf)
+				? LexToStringView(static_cast<EAwesomenessLevel>(NameIndex))
+				: InvalidNames[RandomStream.RandHelper(UE_ARRAY_COUNT(InvalidNames))]);
+		Corpus.Add(RandomStream.FRand() < 0.5f ? Name.ToLower() : MoveTemp(Name));
+	}
+
+	const UEnum* AwesomenessLevelEnum = StaticEnum<EAwesomenessLevel>();
+	int32 NumParsed = 0;
+	int32 NumReflectionParsed = 0;
+	const double ParseSeconds = MeasureAverageSeconds(TEXT("TryLexFromString"), 1, [&]() {
+		for (const FString& Name : Corpus)
+		{
+			EAwesomenessLevel AwesomenessLevel;
+			NumParsed += TryLexFromString(AwesomenessLevel, Name) ? 1 : 0;
+		}
+	});
+	const double ReflectionSeconds = MeasureAverageSeconds(TEXT("UEnum::GetValueByNameString"), 1, [&]() {
+		for (const FString& Name : Corpus)
+		{
+			const int64 Value = AwesomenessLevelEnum->GetValueByNameString(Name);
+			const bool bIsValidLevel = (Value >= 0 && Value < static_cast<int64>(EAwesomenessLevel::NumOf));
+			NumReflectionParsed += bIsValidLevel ? 1 : 0;
+		}
+	});
+
+	TestEqual(TEXT("Names accepted by TryLexFromString and by reflection"), NumParsed, NumReflectionParsed);
+
+	AddInfo(FString::Printf(
+		TEXT("%i names: TryLexFromString %s, reflection %s (%.2fx)"),
+		NumNames,
+		*FPlatformTime::PrettyTime(ParseSeconds),
+		*FPlatformTime::PrettyTime(ReflectionSeconds),
+		ReflectionSeconds / FMath::Max(ParseSeconds, UE_SMALL_NUMBER)));
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardBodyPartColorUsesTest,
+	"OUUCodingStandard.Character.BodyPartColorUses",
+	OUU::CodingStandard::Tests::TestFlags)
+
+bool FOUUCodingStandardBodyPartColorUsesTest::RunTest(const FString& Parameters)
+{
+	const OUU::CodingStandard::Tests::FScopedTestWorld TestWorld;
+	AOUUExampleCharacter* Character = TestWorld.Get().SpawnActor<AOUUExampleCharacter>();
+	if (!TestNotNull(TEXT("Spawned character"), Character))
+		return false;
+
+	// Checks the incrementally tracked color uses against a search through all body parts.
+	const auto TestColorUses = [&](const TCHAR* What) {
+		bool bHasAllColors = true;
+		for (const auto Color : TEnumRange<EOUUExampleBodyPartColor>())
+		{
+			bool bIsColorUsed = false;
+			for (int32 BodyPartIndex = 0; BodyPartIndex < AOUUExampleCharacter::NumBodyParts; ++BodyPartIndex)
+			{
+				bIsColorUsed |= (Character->GetBodyPartColor(BodyPartIndex) == Color);
+			}
+			bHasAllColors &= bIsColorUsed;
+		}
+		TestEqual(What, Character->HasAllColorsPossible(), bHasAllColors);
+	};
+
+	TestColorUses(TEXT("HasAllColorsPossible after spawning"));
+
+	FRandomStream RandomStream(42);
+	const auto GetRandomColor = [&]() {
+		return static_cast<EOUUExampleBodyPartColor>(
+			RandomStream.RandHelper(static_cast<int32>(EOUUExampleBodyPartColor::Count)));
+	};
+	for (int32 Step = 0; Step < 100; ++Step)
+	{
+		// Mix single body part and outfit changes, because they update the color uses on different paths.
+		if (RandomStream.FRand() < 0.5f)
+		{
+			const int32 BodyPartIndex = RandomStream.RandHelper(AOUUExampleCharacter::NumBodyParts);
+			Character->ColorBodyPart(AOUUExampleCharacter::BodyPartNames[BodyPartIndex], GetRandomColor());
+			TestColorUses(TEXT("HasAllColorsPossible after ColorBodyPart"));
+		}
+		else
+		{
+			using FBodyPartColorAllocator = TInlineAllocator<AOUUExampleCharacter::NumBodyParts>;
+			TArray<FOUUExampleBodyPartColorEntry, FBodyPartColorAllocator> NewBodyPartColors;
+			for (const FName BodyPartName : AOUUExampleCharacter::BodyPartNames)
+			{
+				NewBodyPartColors.Emplace(BodyPartName, GetRandomColor());
+			}
+			Character->ColorBodyParts(NewBodyPartColors);
+			TestColorUses(TEXT("HasAllColorsPossible after ColorBodyParts"));
+		}
+	}
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardColorBodyPartsEventsTest,
+	"OUUCodingStandard.Character.ColorBodyPartsEvents",
+	OUU::CodingStandard::Tests::TestFlags)
+
+bool FOUUCodingStandardColorBodyPartsEventsTest::RunTest(const FString& Parameters)
+{
+	const OUU::CodingStandard::Tests::FScopedTestWorld TestWorld;
+	AOUUExampleCharacter* Character = TestWorld.Get().SpawnActor<AOUUExampleCharacter>();
+	if (!TestNotNull(TEXT("Spawned character"), Character))
+		return false;
+
+	const FOUUExampleBodyPartColorEntry Outfit[] = {
+		{AOUUExampleCharacter::HeadBodyPartName, EOUUExampleBodyPartColor::Green},
+		{AOUUExampleCharacter::TorsoBodyPartName, EOUUExampleBodyPartColor::Blue}};
+	const auto IsOutfitApplied = [&]() {
+		return Character->GetBodyPartColor(AOUUExampleCharacter::HeadBodyPartIndex) == EOUUExampleBodyPartColor::Green
+			&& Character->GetBodyPartColor(AOUUExampleCharacter::TorsoBodyPartIndex) == EOUUExampleBodyPartColor::Blue;
+	};
+
+	int32 NumBodyPartColorChanged = 0;
+	int32 NumHeadColorChanged = 0;
+	int32 NumTorsoColorChanged = 0;
+	int32 NumBodyPartColorsChanged = 0;
+	bool bWasOutfitAppliedBeforeEvents = true;
+	Character->OnBodyPartColorChangedNative.AddLambda([&](FName, EOUUExampleBodyPartColor, EOUUExampleBodyPartColor) {
+		++NumBodyPartColorChanged;
+		bWasOutfitAppliedBeforeEvents &= IsOutfitApplied();
+	});
+	Character->OnHeadColorChangedNative.AddLambda([&](FName, EOUUExampleBodyPartColor, EOUUExampleBodyPartColor) {
+		++NumHeadColorChanged;
+	});
+	Character->OnTorsoColorChangedNative.AddLambda([&](FName, EOUUExampleBodyPartColor, EOUUExampleBodyPartColor) {
+		++NumTorsoColorChanged;
+	});
+	Character->OnBodyPartColorsChangedNative.AddLambda([&](TConstArrayView<FOUUExampleBodyPartColorChange> Changes) {
+		++NumBodyPartColorsChanged;
+		TestEqual(TEXT("Number of changes in the batch event"), Changes.Num(), AOUUExampleCharacter::NumBodyParts);
+		TestEqual(
+			TEXT("Per body part events before the batch event"),
+			NumBodyPartColorChanged,
+			AOUUExampleCharacter::NumBodyParts);
+	});
+
+	TestTrue(TEXT("ColorBodyParts"), Character->ColorBodyParts(Outfit));
+	TestEqual(TEXT("OnBodyPartColorChanged calls"), NumBodyPartColorChanged, AOUUExampleCharacter::NumBodyParts);
+	TestEqual(TEXT("OnHeadColorChanged calls"), NumHeadColorChanged, 1);
+	TestEqual(TEXT("OnTorsoColorChanged calls"), NumTorsoColorChanged, 1);
+	TestEqual(TEXT("OnBodyPartColorsChanged calls"), NumBodyPartColorsChanged, 1);
+	TestTrue(TEXT("All colors applied before the per body part events"), bWasOutfitAppliedBeforeEvents);
+
+	// Applying the same outfit again changes nothing, so no event must be called.
+	TestTrue(TEXT("ColorBodyParts with unchanged colors"), Character->ColorBodyParts(Outfit));
+	TestEqual(
+		TEXT("OnBodyPartColorChanged calls after unchanged colors"),
+		NumBodyPartColorChanged,
+		AOUUExampleCharacter::NumBodyParts);
+	TestEqual(TEXT("OnBodyPartColorsChanged calls after unchanged colors"), NumBodyPartColorsChanged, 1);
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardColorBodyPartsPerfTest,
+	"OUUCodingStandard.Character.ColorBodyParts.Performance",
+	OUU::CodingStandard::Tests::PerfTestFlags)
+
+bool FOUUCodingStandardColorBodyPartsPerfTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	constexpr int32 NumCharacters = 1000;
+	const FScopedTestWorld TestWorld;
+	TArray<AOUUExampleCharacter*> Characters;
+	Characters.Reserve(NumCharacters);
+	for (int32 Index = 0; Index < NumCharacters; ++Index)
+	{
+		Characters.Add(TestWorld.Get().SpawnActor<AOUUExampleCharacter>());
+	}
+
+	// Alternate between two outfits, so every swap changes all body parts.
+	TArray<FOUUExampleBodyPartColorEntry> Outfits[2];
+	for (const FName BodyPartName : AOUUExampleCharacter::BodyPartNames)
+	{
+		Outfits[0].Emplace(BodyPartName, EOUUExampleBodyPartColor::Green);
+		Outfits[1].Emplace(BodyPartName, EOUUExampleBodyPartColor::Blue);
+	}
+
+	int32 NumSwaps = 0;
+	const double SingleSeconds = MeasureAverageSeconds(TEXT("Swap outfits with ColorBodyPart"), 10, [&]() {
+		const auto& Outfit = Outfits[NumSwaps++ % 2];
+		for (AOUUExampleCharacter* Character : Characters)
+		{
+			for (const auto& BodyPartColorEntry : Outfit)
+			{
+				Character->ColorBodyPart(BodyPartColorEntry.BodyPartName, BodyPartColorEntry.BodyPartColor);
+			}
+		}
+	});
+	const double BatchSeconds = MeasureAverageSeconds(TEXT("Swap outfits with ColorBodyParts"), 10, [&]() {
+		const auto& Outfit = Outfits[NumSwaps++ % 2];
+		for (AOUUExampleCharacter* Character : Characters)
+		{
+			Character->ColorBodyParts(Outfit);
+		}
+	});
+
+	AddInfo(FString::Printf(
+		TEXT("Outfit swap of %i characters: per body part %s, batched %s"),
+		NumCharacters,
+		*FPlatformTime::PrettyTime(SingleSeconds),
+		*FPlatformTime::PrettyTime(BatchSeconds)));
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardBodyPartColorEventsPerfTest,
+	"OUUCodingStandard.Character.BodyPartColorEvents.Performance",
+	OUU::CodingStandard::Tests::PerfTestFlags)
+
+bool FOUUCodingStandardBodyPartColorEventsPerfTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	const FScopedTestWorld TestWorld;
+	AOUUExampleCharacter* Character = TestWorld.Get().SpawnActor<AOUUExampleCharacter>();
+	if (!TestNotNull(TEXT("Spawned character"), Character))
+		return false;
+
+	// Dynamic listeners need UFUNCTIONs, so only C++ listeners are measured. The dynamic events have no listeners and
+	// are skipped by the character, which is what C++ only setups see.
+	constexpr int32 NumRecolors = 10000;
+	const EOUUExampleBodyPartColor Colors[] = {EOUUExampleBodyPartColor::Green, EOUUExampleBodyPartColor::Blue};
+	int32 NumCalls = 0;
+	for (const int32 NumListeners : {0, 1, 10})
+	{
+		Character->OnBodyPartColorChangedNative.Clear();
+		for (int32 Index = 0; Index < NumListeners; ++Index)
+		{
+			Character->OnBodyPartColorChangedNative.AddLambda(
+				[&NumCalls](FName, EOUUExampleBodyPartColor, EOUUExampleBodyPartColor) { ++NumCalls; });
+		}
+
+		NumCalls = 0;
+		int32 NumRecolored = 0;
+		const double Seconds = MeasureAverageSeconds(TEXT("Recolor body part"), NumRecolors, [&]() {
+			Character->ColorBodyPartByIndex(AOUUExampleCharacter::HeadBodyPartIndex, Colors[NumRecolored++ % 2]);
+		});
+		TestEqual(TEXT("Listener calls"), NumCalls, NumListeners * NumRecolors);
+
+		AddInfo(FString::Printf(
+			TEXT("Recolor with %i native listeners: %s"),
+			NumListeners,
+			*FPlatformTime::PrettyTime(Seconds)));
+	}
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardBodyPartColorItemNetSerializeTest,
+	"OUUCodingStandard.Character.BodyPartColorItemNetSerialize",
+	OUU::CodingStandard::Tests::TestFlags)
+
+bool FOUUCodingStandardBodyPartColorItemNetSerializeTest::RunTest(const FString& Parameters)
+{
+	constexpr uint32 NumBodyPartColors = static_cast<uint32>(EOUUExampleBodyPartColor::Count);
+	const int64 MaxNumBits = FMath::CeilLogTwo(static_cast<uint32>(AOUUExampleCharacter::NumBodyParts))
+		+ FMath::CeilLogTwo(NumBodyPartColors);
+
+	// Out of range values can't be tested: SerializeInt() stops reading once the next bit would exceed the maximum,
+	// so no bit pattern is read as an out of range value.
+	for (int32 BodyPartIndex = 0; BodyPartIndex < AOUUExampleCharacter::NumBodyParts; ++BodyPartIndex)
+	{
+		for (const auto Color : TEnumRange<EOUUExampleBodyPartColor>())
+		{
+			FOUUExampleBodyPartColorItem Item;
+			Item.BodyPartIndex = static_cast<uint8>(BodyPartIndex);
+			Item.BodyPartColor = Color;
+
+			FBitWriter Writer(0, true);
+			bool bWriteSuccess = false;
+			Item.NetSerialize(Writer, nullptr, bWriteSuccess);
+			TestTrue(TEXT("Write succeeded"), bWriteSuccess && !Writer.IsError());
+			TestTrue(TEXT("Number of written bits is within the packed size"), Writer.GetNumBits() <= MaxNumBits);
+
+			FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+			FOUUExampleBodyPartColorItem ReadItem;
+			ReadItem.BodyPartIndex = MAX_uint8;
+			bool bReadSuccess = false;
+			ReadItem.NetSerialize(Reader, nullptr, bReadSuccess);
+			TestTrue(TEXT("Read succeeded"), bReadSuccess && !Reader.IsError());
+			TestEqual(TEXT("Number of read bits"), Reader.GetPosBits(), Writer.GetNumBits());
+			TestEqual(TEXT("Body part index after round trip"), ReadItem.BodyPartIndex, Item.BodyPartIndex);
+			TestTrue(TEXT("Body part color after round trip"), ReadItem.BodyPartColor == Item.BodyPartColor);
+		}
+	}
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardBodyPartColorItemNetSerializePerfTest,
+	"OUUCodingStandard.Character.BodyPartColorItemNetSerialize.Performance",
+	OUU::CodingStandard::Tests::PerfTestFlags)
+
+bool FOUUCodingStandardBodyPartColorItemNetSerializePerfTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	// Payload of a full update of all body part colors of 100 characters with random colors.
+	constexpr int32 NumCharacters = 100;
+	constexpr int32 NumItems = NumCharacters * AOUUExampleCharacter::NumBodyParts;
+	FRandomStream RandomStream(42);
+	TArray<FOUUExampleBodyPartColorItem> Items;
+	Items.SetNum(NumItems);
+	for (int32 Index = 0; Index < NumItems; ++Index)
+	{
+		Items[Index].BodyPartIndex = static_cast<uint8>(Index % AOUUExampleCharacter::NumBodyParts);
+		Items[Index].BodyPartColor = static_cast<EOUUExampleBodyPartColor>(
+			RandomStream.RandHelper(static_cast<int32>(EOUUExampleBodyPartColor::Count)));
+	}
+
+	int64 NumBits = 0;
+	const double Seconds = MeasureAverageSeconds(TEXT("NetSerialize body part color items"), 100, [&]() {
+		FBitWriter Writer(0, true);
+		for (FOUUExampleBodyPartColorItem& Item : Items)
+		{
+			bool bSuccess = false;
+			Item.NetSerialize(Writer, nullptr, bSuccess);
+		}
+		NumBits = Writer.GetNumBits();
+	});
+
+	// Default property serialization writes a full byte for each of the two fields.
+	constexpr int64 NumUnpackedBits = NumItems * 2 * 8;
+	AddInfo(FString::Printf(
+		TEXT("%i items of %i characters: %lld bits packed vs %lld bits unpacked (%.1f%%), serialized in %s"),
+		NumItems,
+		NumCharacters,
+		NumBits,
+		NumUnpackedBits,
+		100.0 * NumBits / NumUnpackedBits,
+		*FPlatformTime::PrettyTime(Seconds)));
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardRPCBatcherSpawnTest,
+	"OUUCodingStandard.Character.RPCBatcherSpawn",
+	OUU::CodingStandard::Tests::TestFlags)
+
+bool FOUUCodingStandardRPCBatcherSpawnTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	IConsoleVariable* BatchCVar =
+		IConsoleManager::Get().FindConsoleVariable(TEXT("ouu.CodingStandard.BatchMulticastRPCs"));
+	if (!TestNotNull(TEXT("BatchMulticastRPCs cvar"), BatchCVar))
+		return false;
+
+	const bool bBatchBefore = BatchCVar->GetBool();
+	ON_SCOPE_EXIT
+	{
+		BatchCVar->Set(bBatchBefore);
+	};
+
+	const auto CountRPCBatchers = [this](const FScopedTestWorld& TestWorld) {
+		int32 NumRPCBatchers = 0;
+		for (const auto* RPCBatcher : TActorRange<AOUUExampleCharacterRPCBatcher>(&TestWorld.Get()))
+		{
+			++NumRPCBatchers;
+			TestTrue(TEXT("RPC batcher is always relevant"), RPCBatcher->bAlwaysRelevant);
+		}
+		return NumRPCBatchers;
+	};
+
+	// Without batching, no world pays for the batcher and its always relevant channel.
+	BatchCVar->Set(false);
+	{
+		const FScopedTestWorld TestWorld;
+		TestEqual(TEXT("RPC batchers after BeginPlay without batching"), CountRPCBatchers(TestWorld), 0);
+
+		// Enabling batching later spawns the batcher with the first flush.
+		auto* Character = TestWorld.Get().SpawnActor<AOUUExampleCharacter>();
+		if (!TestNotNull(TEXT("Spawned character"), Character))
+			return false;
+
+		BatchCVar->Set(true);
+		Character->SendDataToEveryone();
+		TestWorld.Tick();
+		TestEqual(TEXT("RPC batchers after enabling batching"), CountRPCBatchers(TestWorld), 1);
+	}
+
+	// The batcher must exist before any character sends data, so clients open its channel ahead of the first batch.
+	BatchCVar->Set(true);
+	{
+		const FScopedTestWorld TestWorld;
+		TestEqual(TEXT("RPC batchers after BeginPlay with batching"), CountRPCBatchers(TestWorld), 1);
+	}
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardCharacterRegistryTest,
+	"OUUCodingStandard.Subsystem.CharacterRegistry",
+	OUU::CodingStandard::Tests::TestFlags)
+
+bool FOUUCodingStandardCharacterRegistryTest::RunTest(const FString& Parameters)
+{
+	const OUU::CodingStandard::Tests::FScopedTestWorld TestWorld;
+	auto* Subsystem = TestWorld.Get().GetSubsystem<UOUUExampleCharacterSubsystem>();
+	if (!TestNotNull(TEXT("Character subsystem"), Subsystem))
+		return false;
+
+	const int32 MinAwesomeness = UOUUExampleBlueprintFunctionLibrary::GetAwesomenessThreshold();
+	FRandomStream RandomStream(42);
+	TArray<AOUUExampleCharacter*> Characters;
+	for (int32 Index = 0; Index < 50; ++Index)
+	{
+		auto* Character = TestWorld.Get().SpawnActor<AOUUExampleCharacter>();
+		Character->SetAwesomeness(RandomStream.RandRange(-MinAwesomeness, 2 * MinAwesomeness));
+		Character->SetScore(RandomStream.RandRange(0, 1000));
+		Character->ColorBodyPartByIndex(
+			RandomStream.RandHelper(AOUUExampleCharacter::NumBodyParts),
+			static_cast<EOUUExampleBodyPartColor>(RandomStream.RandHelper(AOUUExampleCharacter::NumBodyPartColors)));
+		Characters.Add(Character);
+	}
+
+	// Listeners must see the registry already updated to the new level.
+	AOUUExampleCharacter* ChangedCharacter = Characters[0];
+	ChangedCharacter->SetAwesomeness(-1);
+	const int32 NumAwesomeBefore =
+		Subsystem->CountCharactersByAwesomenessLevel()[static_cast<int32>(EAwesomenessLevel::Awesome)];
+	int32 NumAwesomenessChanged = 0;
+	ChangedCharacter->OnAwesomenessChanged.AddLambda([&](EAwesomenessLevel) {
+		++NumAwesomenessChanged;
+		TestEqual(
+			TEXT("Awesome characters in the registry while OnAwesomenessChanged is broadcast"),
+			Subsystem->CountCharactersByAwesomenessLevel()[static_cast<int32>(EAwesomenessLevel::Awesome)],
+			NumAwesomeBefore + 1);
+	});
+	ChangedCharacter->SetAwesomeness(MinAwesomeness);
+	TestEqual(TEXT("OnAwesomenessChanged calls"), NumAwesomenessChanged, 1);
+
+	TStaticArray<int32, UOUUExampleCharacterSubsystem::NumAwesomenessLevels> NumCharactersByAwesomenessLevel(
+		InPlace,
+		0);
+	int32 NumCharactersWithAllColors = 0;
+	int64 TotalScore = 0;
+	for (const AOUUExampleCharacter* Character : TActorRange<AOUUExampleCharacter>(&TestWorld.Get()))
+	{
+		++NumCharactersByAwesomenessLevel[static_cast<int32>(Character->GetAwesomenessLevel())];
+		NumCharactersWithAllColors += Character->HasAllColorsPossible() ? 1 : 0;
+		TotalScore += Character->GetScore();
+
+		uint8 UsedBodyPartColorsMask = 0;
+		for (int32 BodyPartIndex = 0; BodyPartIndex < AOUUExampleCharacter::NumBodyParts; ++BodyPartIndex)
+		{
+			UsedBodyPartColorsMask |= 1 << static_cast<int32>(Character->GetBodyPartColor(BodyPartIndex));
+		}
+		TestEqual(TEXT("Used body part colors mask"), Character->GetUsedBodyPartColorsMask(), UsedBodyPartColorsMask);
+	}
+
+	TestEqual(TEXT("Number of characters"), Subsystem->GetNumCharacters(), Characters.Num());
+	TestTrue(
+		TEXT("Characters by awesomeness level"),
+		Subsystem->CountCharactersByAwesomenessLevel() == NumCharactersByAwesomenessLevel);
+	TestEqual(
+		TEXT("Characters with all colors"),
+		Subsystem->CountCharactersWithAllColors(),
+		NumCharactersWithAllColors);
+	TestEqual(TEXT("Total score"), Subsystem->GetTotalScore(), TotalScore);
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardCharacterRegistryPerfTest,
+	"OUUCodingStandard.Subsystem.CharacterRegistry.Performance",
+	OUU::CodingStandard::Tests::PerfTestFlags)
+
+bool FOUUCodingStandardCharacterRegistryPerfTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	constexpr int32 NumCharacters = 1000;
+	const FScopedTestWorld TestWorld;
+	auto* Subsystem = TestWorld.Get().GetSubsystem<UOUUExampleCharacterSubsystem>();
+	if (!TestNotNull(TEXT("Character subsystem"), Subsystem))
+		return false;
+
+	FRandomStream RandomStream(42);
+	for (int32 Index = 0; Index < NumCharacters; ++Index)
+	{
+		auto* Character = TestWorld.Get().SpawnActor<AOUUExampleCharacter>();
+		Character->SetAwesomeness(RandomStream.RandRange(-1000, 1000));
+	}
+
+	// Same query through the registry and through an actor iteration like before the registry existed.
+	int32 NumAwesome = 0;
+	int32 NumIteratedAwesome = 0;
+	const double RegistrySeconds = MeasureAverageSeconds(TEXT("Count awesome characters in registry"), 100, [&]() {
+		NumAwesome = Subsystem->CountCharactersByAwesomenessLevel()[static_cast<int32>(EAwesomenessLevel::Awesome)];
+	});
+	const double IteratorSeconds = MeasureAverageSeconds(TEXT("Count awesome characters by iteration"), 100, [&]() {
+		NumIteratedAwesome = 0;
+		for (const AOUUExampleCharacter* Character : TActorRange<AOUUExampleCharacter>(&TestWorld.Get()))
+		{
+			NumIteratedAwesome += (Character->GetAwesomenessLevel() == EAwesomenessLevel::Awesome) ? 1 : 0;
+		}
+	});
+	TestEqual(TEXT("Awesome characters"), NumAwesome, NumIteratedAwesome);
+
+	AddInfo(FString::Printf(
+		TEXT("Count awesome characters of %i: registry %s, actor iterator %s"),
+		NumCharacters,
+		*FPlatformTime::PrettyTime(RegistrySeconds),
+		*FPlatformTime::PrettyTime(IteratorSeconds)));
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardUpdateAwesomenessLevelsPerfTest,
+	"OUUCodingStandard.Subsystem.UpdateAwesomenessLevels.Performance",
+	OUU::CodingStandard::Tests::PerfTestFlags)
+
+bool FOUUCodingStandardUpdateAwesomenessLevelsPerfTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	for (const int32 NumCharacters : {1000, 10000})
+	{
+		const FScopedTestWorld TestWorld;
+		auto* Subsystem = TestWorld.Get().GetSubsystem<UOUUExampleCharacterSubsystem>();
+		if (!TestNotNull(TEXT("Character subsystem"), Subsystem))
+			return false;
+
+		FRandomStream RandomStream(42);
+		for (int32 Index = 0; Index < NumCharacters; ++Index)
+		{
+			auto* Character = TestWorld.Get().SpawnActor<AOUUExampleCharacter>();
+			Character->SetAwesomeness(RandomStream.RandRange(-1000, 1000));
+		}
+
+		const double Seconds = MeasureAverageSeconds(TEXT("Update awesomeness levels"), 10, [&]() {
+			Subsystem->UpdateAwesomenessLevels();
+		});
+		AddInfo(FString::Printf(
+			TEXT("Update awesomeness levels of %i characters: %s"),
+			NumCharacters,
+			*FPlatformTime::PrettyTime(Seconds)));
+	}
+
+	// The task graph is created at startup, so scaling is measured by limiting the number of tasks that share the
+	// chunks instead. Each task processes a contiguous range of chunks, so at most that many threads work at once.
+	constexpr int32 NumValues = 1024 * 1024;
+	constexpr int32 ChunkSize = 1024;
+	constexpr int32 NumChunks = NumValues / ChunkSize;
+	FRandomStream RandomStream(42);
+	TArray<int32> Awesomeness;
+	Awesomeness.SetNumUninitialized(NumValues);
+	for (int32& Value : Awesomeness)
+	{
+		Value = RandomStream.RandRange(-1000, 1000);
+	}
+	TArray<EAwesomenessLevel> AwesomenessLevels;
+	AwesomenessLevels.SetNumUninitialized(NumValues);
+
+	const int32 NumAvailableWorkers = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+	double SingleWorkerSeconds = 0.0;
+	for (const int32 NumWorkers : {1, 2, 4, 8, 16})
+	{
+		const TArrayView<const int32> Input = Awesomeness;
+		const TArrayView<EAwesomenessLevel> Output = AwesomenessLevels;
+		const double Seconds = MeasureAverageSeconds(TEXT("Update awesomeness levels on N workers"), 10, [&]() {
+			ParallelFor(
+				NumWorkers,
+				[&](int32 WorkerIndex) {
+					const int32 ChunkStart = NumChunks * WorkerIndex / NumWorkers * ChunkSize;
+					const int32 ChunkEnd = NumChunks * (WorkerIndex + 1) / NumWorkers * ChunkSize;
+					OUU::CodingStandard::AwesomenessLevelsFromIntValues(
+						Input.Slice(ChunkStart, ChunkEnd - ChunkStart),
+						Output.Slice(ChunkStart, ChunkEnd - ChunkStart));
+				},
+				NumWorkers > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+		});
+		SingleWorkerSeconds = (NumWorkers == 1) ? Seconds : SingleWorkerSeconds;
+
+		AddInfo(FString::Printf(
+			TEXT("%i values on %i workers (%i available): %s, speedup %.2fx"),
+			NumValues,
+			NumWorkers,
+			NumAvailableWorkers,
+			*FPlatformTime::PrettyTime(Seconds),
+			SingleWorkerSeconds / Seconds));
+	}
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardCrowdAwesomenessProcessorTest,
+	"OUUCodingStandard.Subsystem.Crowd.AwesomenessProcessor",
+	OUU::CodingStandard::Tests::TestFlags)
+
+bool FOUUCodingStandardCrowdAwesomenessProcessorTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	const FScopedTestWorld TestWorld;
+	auto* Subsystem = TestWorld.Get().GetSubsystem<UOUUExampleCharacterSubsystem>();
+	auto* EntitySubsystem = TestWorld.Get().GetSubsystem<UMassEntitySubsystem>();
+	if (!TestNotNull(TEXT("Character subsystem"), Subsystem) || !TestNotNull(TEXT("Entity subsystem"), EntitySubsystem))
+		return false;
+
+	// Cover multiple chunks, so the processor has to visit all of them.
+	constexpr int32 NumCrowdMembers = 5000;
+	const int32 MinAwesomeness = UOUUExampleBlueprintFunctionLibrary::GetAwesomenessThreshold();
+	const int32 RandomRange = 2 * FMath::Abs(MinAwesomeness) + 1;
+	FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
+	FRandomStream RandomStream(42);
+	TArray<FMassEntityHandle> CrowdMembers;
+	for (int32 Index = 0; Index < NumCrowdMembers; ++Index)
+	{
+		// Far away from any viewpoint, so no crowd member is promoted.
+		const FOUUExampleCrowdMemberHandle CrowdMemberHandle = Subsystem->AddCrowdMember(
+			FVector(1.e7f, 0.f, 0.f),
+			RandomStream.RandRange(-RandomRange, RandomRange));
+		const FMassEntityHandle CrowdMember = OUU::CodingStandard::Private::ToEntityHandle(CrowdMemberHandle);
+		EntityManager.GetFragmentDataChecked<FOUUExampleAwesomenessLevelFragment>(CrowdMember).AwesomenessLevel =
+			EAwesomenessLevel::NumOf;
+		CrowdMembers.Add(CrowdMember);
+	}
+	TestEqual(TEXT("Crowd members"), Subsystem->GetNumCrowdMembers(), NumCrowdMembers);
+
+	Subsystem->UpdateCrowdAwesomenessLevels();
+	int32 NumMismatches = 0;
+	for (const FMassEntityHandle CrowdMember : CrowdMembers)
+	{
+		const int32 Awesomeness =
+			EntityManager.GetFragmentDataChecked<FOUUExampleAwesomenessFragment>(CrowdMember).Awesomeness;
+		const EAwesomenessLevel AwesomenessLevel =
+			EntityManager.GetFragmentDataChecked<FOUUExampleAwesomenessLevelFragment>(CrowdMember).AwesomenessLevel;
+		NumMismatches += (AwesomenessLevel != OUU::CodingStandard::AwesomenessLevelFromIntValue(Awesomeness)) ? 1 : 0;
+	}
+	TestEqual(TEXT("Crowd members with wrong awesomeness level"), NumMismatches, 0);
+
+	Subsystem->ResetCrowd();
+	TestEqual(TEXT("Crowd members after reset"), Subsystem->GetNumCrowdMembers(), 0);
+	TestFalse(TEXT("Entity is destroyed by reset"), EntityManager.IsEntityValid(CrowdMembers[0]));
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardCrowdPromotionTest,
+	"OUUCodingStandard.Subsystem.Crowd.Promotion",
+	OUU::CodingStandard::Tests::TestFlags)
+
+bool FOUUCodingStandardCrowdPromotionTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	const FScopedTestWorld TestWorld;
+	auto* Subsystem = TestWorld.Get().GetSubsystem<UOUUExampleCharacterSubsystem>();
+	if (!TestNotNull(TEXT("Character subsystem"), Subsystem))
+		return false;
+
+	const int32 MinAwesomeness = UOUUExampleBlueprintFunctionLibrary::GetAwesomenessThreshold();
+	const EOUUExampleBodyPartColor BodyPartColors[] = {EOUUExampleBodyPartColor::Green, EOUUExampleBodyPartColor::Blue};
+	const FOUUExampleCrowdMemberHandle NearCrowdMember =
+		Subsystem->AddCrowdMember(FVector::ZeroVector, MinAwesomeness, BodyPartColors);
+	const FOUUExampleCrowdMemberHandle FarCrowdMember =
+		Subsystem->AddCrowdMember(FVector(1.e7f, 0.f, 0.f), MinAwesomeness);
+
+	// The player viewpoint of a controller without pawn is at its own location.
+	auto* PlayerController = TestWorld.Get().SpawnActor<APlayerController>();
+	TestWorld.Tick();
+
+	auto* Character = Subsystem->GetPromotedCrowdCharacter(NearCrowdMember);
+	if (!TestNotNull(TEXT("Crowd member near the viewer is promoted"), Character))
+		return false;
+
+	TestNull(
+		TEXT("Crowd member far from the viewer is not promoted"),
+		Subsystem->GetPromotedCrowdCharacter(FarCrowdMember));
+	TestEqual(TEXT("Promoted awesomeness"), Character->GetAwesomeness(), MinAwesomeness);
+	TestTrue(
+		TEXT("Promoted body part color"),
+		Character->GetBodyPartColor(AOUUExampleCharacter::TorsoBodyPartIndex) == EOUUExampleBodyPartColor::Blue);
+
+	// The demoted crowd member keeps the changes the actor made while it was promoted.
+	Character->SetAwesomeness(MinAwesomeness + 1);
+	PlayerController->Destroy();
+	TestWorld.Tick();
+	TestNull(TEXT("Crowd member is demoted"), Subsystem->GetPromotedCrowdCharacter(NearCrowdMember));
+
+	PlayerController = TestWorld.Get().SpawnActor<APlayerController>();
+	TestWorld.Tick();
+	Character = Subsystem->GetPromotedCrowdCharacter(NearCrowdMember);
+	if (!TestNotNull(TEXT("Crowd member is promoted again"), Character))
+		return false;
+
+	TestEqual(TEXT("Awesomeness after demotion"), Character->GetAwesomeness(), MinAwesomeness + 1);
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardCrowdPerfTest,
+	"OUUCodingStandard.Subsystem.Crowd.Performance",
+	OUU::CodingStandard::Tests::PerfTestFlags)
+
+bool FOUUCodingStandardCrowdPerfTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	for (const int32 NumCrowdMembers : {1000, 10000, 100000})
+	{
+		const FScopedTestWorld TestWorld;
+		auto* Subsystem = TestWorld.Get().GetSubsystem<UOUUExampleCharacterSubsystem>();
+		if (!TestNotNull(TEXT("Character subsystem"), Subsystem))
+			return false;
+
+		// Spread the crowd far away from the viewer, so the LOD pass doesn't spawn any actors.
+		FRandomStream RandomStream(42);
+		for (int32 Index = 0; Index < NumCrowdMembers; ++Index)
+		{
+			Subsystem->AddCrowdMember(
+				FVector(1.e7f, RandomStream.FRandRange(-1.e6f, 1.e6f), RandomStream.FRandRange(-1.e6f, 1.e6f)),
+				RandomStream.RandRange(-1000, 1000));
+		}
+		TestWorld.Get().SpawnActor<APlayerController>();
+
+		const double AwesomenessSeconds = MeasureAverageSeconds(TEXT("Update crowd awesomeness levels"), 10, [&]() {
+			Subsystem->UpdateCrowdAwesomenessLevels();
+		});
+		// The LOD pass runs as part of the world tick, so this includes the tick of the (empty) world.
+		const double TickSeconds = MeasureAverageSeconds(TEXT("Tick world with crowd"), 10, [&]() {
+			TestWorld.Tick();
+		});
+		AddInfo(FString::Printf(
+			TEXT("%i crowd members: awesomeness levels %s, world tick with LOD pass %s"),
+			NumCrowdMembers,
+			*FPlatformTime::PrettyTime(AwesomenessSeconds),
+			*FPlatformTime::PrettyTime(TickSeconds)));
+	}
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardCrowdExternalReleaseTest,
+	"OUUCodingStandard.Subsystem.Crowd.ExternalRelease",
+	OUU::CodingStandard::Tests::TestFlags)
+
+bool FOUUCodingStandardCrowdExternalReleaseTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	const FScopedTestWorld TestWorld;
+	auto* Subsystem = TestWorld.Get().GetSubsystem<UOUUExampleCharacterSubsystem>();
+	if (!TestNotNull(TEXT("Character subsystem"), Subsystem))
+		return false;
+
+	const int32 MinAwesomeness = UOUUExampleBlueprintFunctionLibrary::GetAwesomenessThreshold();
+	const FOUUExampleCrowdMemberHandle CrowdMember = Subsystem->AddCrowdMember(FVector::ZeroVector, MinAwesomeness);
+	auto* PlayerController = TestWorld.Get().SpawnActor<APlayerController>();
+	TestWorld.Tick();
+
+	auto* Character = Subsystem->GetPromotedCrowdCharacter(CrowdMember);
+	if (!TestNotNull(TEXT("Crowd member is promoted"), Character))
+		return false;
+
+	// Release the promoted actor from outside the crowd and reuse it for something else right away.
+	Character->SetAwesomeness(MinAwesomeness + 1);
+	Subsystem->ReleaseCharacter(*Character);
+	TestNull(TEXT("Released character is unlinked"), Subsystem->GetPromotedCrowdCharacter(CrowdMember));
+
+	auto* ReacquiredCharacter = Subsystem->AcquireCharacter(nullptr, FTransform(FVector(1.e7f, 0.f, 0.f)));
+	TestTrue(TEXT("Released character is reacquired from the pool"), ReacquiredCharacter == Character);
+	ReacquiredCharacter->SetAwesomeness(MinAwesomeness - 1);
+
+	// Neither demotion nor the next promotion may touch the character of its new owner.
+	PlayerController->Destroy();
+	TestWorld.Tick();
+	TestEqual(TEXT("Pooled characters"), Subsystem->GetNumPooledCharacters(), 0);
+	TestFalse(TEXT("Reacquired character is active"), ReacquiredCharacter->IsHidden());
+	TestEqual(TEXT("Reacquired awesomeness"), ReacquiredCharacter->GetAwesomeness(), MinAwesomeness - 1);
+
+	TestWorld.Get().SpawnActor<APlayerController>();
+	TestWorld.Tick();
+	auto* PromotedCharacter = Subsystem->GetPromotedCrowdCharacter(CrowdMember);
+	if (!TestNotNull(TEXT("Crowd member is promoted again"), PromotedCharacter))
+		return false;
+
+	TestTrue(TEXT("Crowd member gets its own actor"), PromotedCharacter != ReacquiredCharacter);
+	TestEqual(TEXT("Awesomeness copied on release"), PromotedCharacter->GetAwesomeness(), MinAwesomeness + 1);
+	TestEqual(TEXT("Reacquired awesomeness"), ReacquiredCharacter->GetAwesomeness(), MinAwesomeness - 1);
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardCharacterPoolPerfTest,
+	"OUUCodingStandard.Subsystem.CharacterPool.Performance",
+	OUU::CodingStandard::Tests::PerfTestFlags)
+
+bool FOUUCodingStandardCharacterPoolPerfTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	constexpr int32 NumCharacters = 100;
+	const FScopedTestWorld TestWorld;
+	auto* Subsystem = TestWorld.Get().GetSubsystem<UOUUExampleCharacterSubsystem>();
+	if (!TestNotNull(TEXT("Character subsystem"), Subsystem))
+		return false;
+
+	// Fresh spawns are destroyed afterwards, so the pool stays empty and every acquire misses.
+	TArray<AOUUExampleCharacter*> Characters;
+	const double SpawnSeconds = MeasureAverageSeconds(TEXT("Spawn characters"), NumCharacters, [&]() {
+		Characters.Add(Subsystem->AcquireCharacter(nullptr, FTransform::Identity));
+	});
+	for (auto* Character : Characters)
+	{
+		Character->Destroy();
+	}
+	Characters.Reset();
+
+	Subsystem->PrewarmCharacterPool(nullptr, NumCharacters);
+	const int32 NumPooledCharacters = Subsystem->GetNumPooledCharacters();
+	const double PoolSeconds = MeasureAverageSeconds(TEXT("Acquire pooled characters"), NumCharacters, [&]() {
+		Characters.Add(Subsystem->AcquireCharacter(nullptr, FTransform::Identity));
+	});
+	TestEqual(
+		TEXT("Characters taken from the pool"),
+		NumPooledCharacters - Subsystem->GetNumPooledCharacters(),
+		NumCharacters);
+
+	AddInfo(FString::Printf(
+		TEXT("Acquire character: spawn %s, pool %s"),
+		*FPlatformTime::PrettyTime(SpawnSeconds),
+		*FPlatformTime::PrettyTime(PoolSeconds)));
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardHeadLeaderPoseTest,
+	"OUUCodingStandard.Character.HeadLeaderPose",
+	OUU::CodingStandard::Tests::TestFlags)
+
+bool FOUUCodingStandardHeadLeaderPoseTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	const FScopedTestWorld TestWorld;
+	auto* Character = TestWorld.Get().SpawnActor<AOUUExampleCharacter>();
+	if (!TestNotNull(TEXT("Character"), Character))
+		return false;
+
+	TInlineComponentArray<USkeletalMeshComponent*> MeshComponents(Character);
+	USkeletalMeshComponent* const* HeadMeshComponent = MeshComponents.FindByPredicate(
+		[Character](const USkeletalMeshComponent* MeshComponent) { return MeshComponent != Character->GetMesh(); });
+	if (!TestNotNull(TEXT("Head mesh component"), HeadMeshComponent))
+		return false;
+
+	// Anim evaluation cost can't be compared without skeletal mesh assets, so only the setup is tested here.
+	TestTrue(TEXT("Head follows the body pose"), (*HeadMeshComponent)->LeaderPoseComponent == Character->GetMesh());
+	TestFalse(TEXT("Head mesh ticks"), (*HeadMeshComponent)->IsComponentTickEnabled());
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardBodyPartColorPrimitiveDataTest,
+	"OUUCodingStandard.Character.BodyPartColorPrimitiveData",
+	OUU::CodingStandard::Tests::TestFlags)
+
+bool FOUUCodingStandardBodyPartColorPrimitiveDataTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	const FScopedTestWorld TestWorld;
+	auto* Character = TestWorld.Get().SpawnActor<AOUUExampleCharacter>();
+	if (!TestNotNull(TEXT("Character"), Character))
+		return false;
+
+	Character->ColorBodyPartByIndex(AOUUExampleCharacter::TorsoBodyPartIndex, EOUUExampleBodyPartColor::Blue);
+
+	const TArray<float>& Data = Character->GetMesh()->GetCustomPrimitiveData().Data;
+	const int32 DataIndex =
+		AOUUExampleCharacter::TorsoBodyPartIndex * AOUUExampleCharacter::BodyPartColorPrimitiveDataStride;
+	if (!TestTrue(TEXT("Custom primitive data covers the torso"), Data.IsValidIndex(DataIndex + 2)))
+		return false;
+
+	TestEqual(TEXT("Torso red"), Data[DataIndex], 0.f);
+	TestEqual(TEXT("Torso green"), Data[DataIndex + 1], 0.f);
+	TestEqual(TEXT("Torso blue"), Data[DataIndex + 2], 1.f);
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardBodyPartColorPrimitiveDataPerfTest,
+	"OUUCodingStandard.Character.BodyPartColorPrimitiveData.Performance",
+	OUU::CodingStandard::Tests::PerfTestFlags)
+
+bool FOUUCodingStandardBodyPartColorPrimitiveDataPerfTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	// Only the game thread side can be measured in a test world, because it has no scene renderer.
+	constexpr int32 NumCharacters = 200;
+	const FScopedTestWorld TestWorld;
+	TArray<AOUUExampleCharacter*> Characters;
+	for (int32 Index = 0; Index < NumCharacters; ++Index)
+	{
+		Characters.Add(TestWorld.Get().SpawnActor<AOUUExampleCharacter>());
+	}
+
+	// The MID based approach needs one material instance per body part and character before it can apply colors.
+	UMaterialInterface* BaseMaterial = UMaterial::GetDefaultMaterial(MD_Surface);
+	TArray<UMaterialInstanceDynamic*> MaterialInstances;
+	const double CreateSeconds = MeasureAverageSeconds(TEXT("Create body part MIDs"), NumCharacters, [&]() {
+		for (int32 BodyPartIndex = 0; BodyPartIndex < AOUUExampleCharacter::NumBodyParts; ++BodyPartIndex)
+		{
+			MaterialInstances.Add(UMaterialInstanceDynamic::Create(BaseMaterial, GetTransientPackage()));
+		}
+	});
+
+	int32 NumUpdates = 0;
+	const double MaterialSeconds = MeasureAverageSeconds(TEXT("Color body parts via MIDs"), 10, [&]() {
+		const FLinearColor Color = (NumUpdates++ % 2) ? FLinearColor::Red : FLinearColor::Blue;
+		for (auto* MaterialInstance : MaterialInstances)
+		{
+			MaterialInstance->SetVectorParameterValue(TEXT("Color"), Color);
+		}
+	});
+	const double PrimitiveDataSeconds = MeasureAverageSeconds(TEXT("Color body parts via primitive data"), 10, [&]() {
+		const EOUUExampleBodyPartColor Color =
+			(NumUpdates++ % 2) ? EOUUExampleBodyPartColor::Red : EOUUExampleBodyPartColor::Blue;
+		for (auto* Character : Characters)
+		{
+			for (int32 BodyPartIndex = 0; BodyPartIndex < AOUUExampleCharacter::NumBodyParts; ++BodyPartIndex)
+			{
+				Character->ColorBodyPartByIndex(BodyPartIndex, Color);
+			}
+		}
+	});
+
+	AddInfo(FString::Printf(
+		TEXT("%i characters: create MIDs %s per character, recolor all via MIDs %s, via primitive data %s"),
+		NumCharacters,
+		*FPlatformTime::PrettyTime(CreateSeconds),
+		*FPlatformTime::PrettyTime(MaterialSeconds),
+		*FPlatformTime::PrettyTime(PrimitiveDataSeconds)));
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardSignificanceEventsTest,
+	"OUUCodingStandard.Character.Significance.ImmediateEvents",
+	OUU::CodingStandard::Tests::TestFlags)
+
+bool FOUUCodingStandardSignificanceEventsTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	IConsoleVariable* DeferEventsCVar =
+		IConsoleManager::Get().FindConsoleVariable(TEXT("ouu.CodingStandard.DeferAwesomenessEvents"));
+	IConsoleVariable* UpdateManagerCVar =
+		IConsoleManager::Get().FindConsoleVariable(TEXT("ouu.CodingStandard.Significance.UpdateManager"));
+	if (!TestNotNull(TEXT("DeferAwesomenessEvents cvar"), DeferEventsCVar)
+		|| !TestNotNull(TEXT("UpdateManager cvar"), UpdateManagerCVar))
+		return false;
+
+	// Nothing else updates the significance manager in the test world.
+	const bool bDeferEventsBefore = DeferEventsCVar->GetBool();
+	const bool bUpdateManagerBefore = UpdateManagerCVar->GetBool();
+	DeferEventsCVar->Set(false);
+	UpdateManagerCVar->Set(true);
+	ON_SCOPE_EXIT
+	{
+		DeferEventsCVar->Set(bDeferEventsBefore);
+		UpdateManagerCVar->Set(bUpdateManagerBefore);
+	};
+
+	// A character far away from the only viewpoint ends up in the least significant bucket.
+	const FScopedTestWorld TestWorld;
+	auto* Character = TestWorld.Get().SpawnActor<AOUUExampleCharacter>(FVector(1.e6f, 0.f, 0.f), FRotator::ZeroRotator);
+	if (!TestNotNull(TEXT("Character"), Character))
+		return false;
+
+	TestWorld.Get().SpawnActor<APlayerController>();
+	TestWorld.Tick();
+	if (Character->GetSignificance() == EOUUExampleCharacterSignificance::High)
+	{
+		AddWarning(TEXT("No significance manager in the test world, so the character stayed highly significant"));
+		return true;
+	}
+
+	// Without deferral, significance only throttles ticks. Events must still be broadcast right away.
+	int32 NumBroadcasts = 0;
+	Character->OnAwesomenessChanged.AddLambda([&NumBroadcasts](EAwesomenessLevel) { ++NumBroadcasts; });
+	const int32 MinAwesomeness = UOUUExampleBlueprintFunctionLibrary::GetAwesomenessThreshold();
+	Character->SetAwesomeness(-1);
+	Character->SetAwesomeness(FMath::Max(MinAwesomeness, 0));
+	TestEqual(TEXT("Immediate awesomeness broadcasts"), NumBroadcasts, 2);
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardMyContainerTest,
+	"OUUCodingStandard.Templates.MyContainer",
+	OUU::CodingStandard::Tests::TestFlags)
+
+bool FOUUCodingStandardMyContainerTest::RunTest(const FString& Parameters)
+{
+	using FStringContainer = OUU::CodingStandard::Templates::TMyContainer<FString, FDefaultAllocator, 8>;
+
+	// Non-trivial elements catch missing constructor and destructor calls when elements spill or move.
+	FStringContainer Container;
+	TArray<FString> Expected;
+	for (int32 Index = 0; Index < 20; ++Index)
+	{
+		Container.Add(FString::FromInt(Index));
+		Expected.Add(FString::FromInt(Index));
+		TestEqual(TEXT("Spilled"), Container.HasSpilled(), Index >= FStringContainer::DefaultSlack);
+	}
+
+	Container.RemoveAt(3);
+	Expected.RemoveAt(3);
+	Container.RemoveAtSwap(0);
+	Expected.RemoveAtSwap(0);
+	TestEqual(TEXT("Removed items"), Container.Remove(TEXT("7")), 1);
+	Expected.Remove(TEXT("7"));
+	TestEqual(TEXT("Find"), Container.Find(TEXT("10")), Expected.Find(TEXT("10")));
+	TestFalse(TEXT("Contains removed item"), Container.Contains(TEXT("3")));
+
+	const FStringContainer Copy = Container;
+	FStringContainer Moved = MoveTemp(Container);
+	TestTrue(TEXT("Moved-from container is empty"), Container.IsEmpty());
+	for (const FStringContainer* Result : {&Copy, &Moved})
+	{
+		TestTrue(TEXT("Elements"), TArray<FString>(Result->GetData(), Result->Num()) == Expected);
+	}
+
+	Moved.Empty();
+	TestFalse(TEXT("Spilled after Empty()"), Moved.HasSpilled());
+	TestEqual(TEXT("Capacity after Empty()"), Moved.Max(), FStringContainer::DefaultSlack);
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardMyContainerPerfTest,
+	"OUUCodingStandard.Templates.MyContainer.Performance",
+	OUU::CodingStandard::Tests::PerfTestFlags)
+
+bool FOUUCodingStandardMyContainerPerfTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	constexpr int32 InlineSize = 16;
+	constexpr int32 NumIterations = 100000;
+	for (const int32 NumElements : {4, 8, 16, 32, 64})
+	{
+		// Fill, iterate and destroy a short lived container like a typical local gather buffer.
+		// The sum keeps the compiler from optimizing the containers away.
+		int64 Sum = 0;
+		const auto MeasureContainer = [&](const TCHAR* Name, auto Container) {
+			return MeasureAverageSeconds(Name, NumIterations, [&]() {
+				auto LocalContainer = Container;
+				for (int32 Index = 0; Index < NumElements; ++Index)
+				{
+					LocalContainer.Add(Index);
+				}
+				for (const int32 Element : LocalContainer)
+				{
+					Sum += Element;
+				}
+			});
+		};
+		const double HeapSeconds = MeasureContainer(TEXT("TArray"), TArray<int32>());
+		const double InlineSeconds =
+			MeasureContainer(TEXT("TArray with inline allocator"), TArray<int32, TInlineAllocator<InlineSize>>());
+		const double MyContainerSeconds = MeasureContainer(
+			TEXT("TMyContainer"),
+			OUU::CodingStandard::Templates::TMyContainer<int32, FDefaultAllocator, InlineSize>());
+		TestEqual(TEXT("Sum"), Sum, int64(3) * NumIterations * NumElements * (NumElements - 1) / 2);
+
+		AddInfo(FString::Printf(
+			TEXT("%i elements (%i inline): TArray %s, TInlineAllocator %s, TMyContainer %s"),
+			NumElements,
+			InlineSize,
+			*FPlatformTime::PrettyTime(HeapSeconds),
+			*FPlatformTime::PrettyTime(InlineSeconds),
+			*FPlatformTime::PrettyTime(MyContainerSeconds)));
+	}
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardMyContainerFindTest,
+	"OUUCodingStandard.Templates.MyContainer.Find",
+	OUU::CodingStandard::Tests::TestFlags)
+
+bool FOUUCodingStandardMyContainerFindTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	TestVectorizedFind<uint8>(*this, TEXT("uint8"));
+	TestVectorizedFind<int16>(*this, TEXT("int16"));
+	TestVectorizedFind<int32>(*this, TEXT("int32"));
+	TestVectorizedFind<uint64>(*this, TEXT("uint64"));
+	TestVectorizedFind<EOUUExampleBodyPartColor>(*this, TEXT("EOUUExampleBodyPartColor"));
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardMyContainerFindPerfTest,
+	"OUUCodingStandard.Templates.MyContainer.Find.Performance",
+	OUU::CodingStandard::Tests::PerfTestFlags)
+
+bool FOUUCodingStandardMyContainerFindPerfTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	constexpr int32 NumSearches = 100000;
+	for (const int32 NumElements : {8, 16, 32, 64, 128, 256})
+	{
+		OUU::CodingStandard::Templates::TMyContainer<int32, FDefaultAllocator, 8> Container;
+		TArray<int32> Array;
+		for (int32 Index = 0; Index < NumElements; ++Index)
+		{
+			Container.Add(Index);
+			Array.Add(Index);
+		}
+
+		// Search for the last element, so both have to scan the whole range. The sums keep the searches alive.
+		int64 VectorSum = 0;
+		int64 ScalarSum = 0;
+		const double VectorSeconds = MeasureAverageSeconds(TEXT("TMyContainer::Find"), NumSearches, [&]() {
+			VectorSum += Container.Find(NumElements - 1);
+		});
+		const double ScalarSeconds = MeasureAverageSeconds(TEXT("TArray::Find"), NumSearches, [&]() {
+			ScalarSum += Array.Find(NumElements - 1);
+		});
+		TestEqual(TEXT("Found indices"), VectorSum, ScalarSum);
+
+		AddInfo(FString::Printf(
+			TEXT("Find in %i int32 elements: TMyContainer %s, TArray %s"),
+			NumElements,
+			*FPlatformTime::PrettyTime(VectorSeconds),
+			*FPlatformTime::PrettyTime(ScalarSeconds)));
+	}
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+namespace OUU::CodingStandard::Tests
+{
+	// Larger alignment than FFrameArena::MinAlignment, so only containers that respect the element alignment pass.
+	struct alignas(64) FOveralignedFrameArenaElement
+	{
+		int32 Value = 0;
+	};
+} // namespace OUU::CodingStandard::Tests
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardFrameArenaAllocatorTest,
+	"OUUCodingStandard.Memory.FrameArenaAllocator",
+	OUU::CodingStandard::Tests::TestFlags)
+
+bool FOUUCodingStandardFrameArenaAllocatorTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+	using OUU::CodingStandard::FFrameArenaAllocator;
+
+	// Both containers pass the element alignment to allocators that support it.
+	TArray<FOveralignedFrameArenaElement, FFrameArenaAllocator> Array;
+	OUU::CodingStandard::Templates::TMyContainer<FOveralignedFrameArenaElement, FFrameArenaAllocator, 8> Container;
+	bool bIsAligned = true;
+	for (int32 Index = 0; Index < 100; ++Index)
+	{
+		// Small allocations in between make the arena offset misaligned for the next growth of the containers.
+		TArray<int32, FFrameArenaAllocator> Padding;
+		Padding.Add(Index);
+
+		Array.Add({Index});
+		Container.Add({Index});
+		bIsAligned &= IsAligned(Array.GetData(), alignof(FOveralignedFrameArenaElement));
+		bIsAligned &= IsAligned(Container.GetData(), alignof(FOveralignedFrameArenaElement));
+	}
+	TestTrue(TEXT("Elements are aligned"), bIsAligned);
+
+	// Growing copies the elements out of earlier allocations.
+	int32 NumMismatches = 0;
+	for (int32 Index = 0; Index < 100; ++Index)
+	{
+		NumMismatches += (Array[Index].Value != Index || Container[Index].Value != Index) ? 1 : 0;
+	}
+	TestEqual(TEXT("Elements with wrong value"), NumMismatches, 0);
+
+	// Allocations beyond the regular chunk size get a dedicated chunk.
+	TArray<uint8, FFrameArenaAllocator> LargeArray;
+	LargeArray.SetNumZeroed(1024 * 1024);
+	TestTrue(TEXT("Large allocation is zeroed"), LargeArray.Last() == 0);
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardFrameArenaAllocatorPerfTest,
+	"OUUCodingStandard.Memory.FrameArenaAllocator.Performance",
+	OUU::CodingStandard::Tests::PerfTestFlags)
+
+bool FOUUCodingStandardFrameArenaAllocatorPerfTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	// All iterations run in the same frame, so the arena keeps growing. Keep the total size at a few megabytes.
+	constexpr int32 NumIterations = 10000;
+	constexpr int32 NumElements = 32;
+	int64 Sum = 0;
+	const auto MeasureArray = [&](const TCHAR* Name, auto Array) {
+		return MeasureAverageSeconds(Name, NumIterations, [&]() {
+			auto LocalArray = Array;
+			for (int32 Index = 0; Index < NumElements; ++Index)
+			{
+				LocalArray.Add(Index);
+			}
+			Sum += LocalArray.Last();
+		});
+	};
+	const double HeapSeconds = MeasureArray(TEXT("TArray on the heap"), TArray<int32>());
+	const double ArenaSeconds =
+		MeasureArray(TEXT("TArray in the frame arena"), TArray<int32, OUU::CodingStandard::FFrameArenaAllocator>());
+	TestEqual(TEXT("Sum"), Sum, int64(2) * NumIterations * (NumElements - 1));
+
+	AddInfo(FString::Printf(
+		TEXT("Build a temporary array of %i elements: heap %s, frame arena %s"),
+		NumElements,
+		*FPlatformTime::PrettyTime(HeapSeconds),
+		*FPlatformTime::PrettyTime(ArenaSeconds)));
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardSetAwesomenessAllocationsTest,
+	"OUUCodingStandard.Character.SetAwesomeness.Allocations",
+	OUU::CodingStandard::Tests::TestFlags)
+
+bool FOUUCodingStandardSetAwesomenessAllocationsTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	const FScopedTestWorld TestWorld;
+	auto* Character = TestWorld.Get().SpawnActor<AOUUExampleCharacter>();
+	if (!TestNotNull(TEXT("Character"), Character))
+		return false;
+
+	// Stay within one level, so no events are broadcast or logged. Only the data copy itself is measured.
+	const int32 MinAwesomeness = FMath::Max(UOUUExampleBlueprintFunctionLibrary::GetAwesomenessThreshold(), 0);
+	Character->SetAwesomeness(MinAwesomeness);
+
+	constexpr int32 NumCalls = 1000;
+	int32 NumAllocations = 0;
+	{
+		FScopedAllocationCounter AllocationCounter;
+		if (!AllocationCounter.CanCountAllocations())
+		{
+			AddWarning(TEXT("Allocations bypass GMalloc in this build and can't be counted"));
+			return true;
+		}
+
+		for (int32 Index = 0; Index < NumCalls; ++Index)
+		{
+			Character->SetAwesomeness(MinAwesomeness + Index);
+		}
+		NumAllocations = AllocationCounter.GetNumAllocations();
+	}
+
+	TestTrue(TEXT("Awesomeness level"), Character->GetAwesomenessLevel() == EAwesomenessLevel::Awesome);
+	TestEqual(TEXT("Allocations of SetAwesomeness"), NumAllocations, 0);
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardPushModelSoakPerfTest,
+	"OUUCodingStandard.Character.PushModel.Soak.Performance",
+	OUU::CodingStandard::Tests::PerfTestFlags)
+
+bool FOUUCodingStandardPushModelSoakPerfTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	// Bots that occasionally score and change colors, like players on a server. The test world has no net driver,
+	// so the compare time itself has to be captured in a networked session. This reports the compare workload:
+	// without push model every replicated property is compared each net update, with push model only dirty ones.
+	constexpr int32 NumBots = 200;
+	constexpr int32 NumFrames = 600;
+	constexpr int32 NumPushModelProperties = 2;
+	constexpr float ScoreChance = 0.05f;
+	constexpr float ColorChance = 0.01f;
+
+	const FScopedTestWorld TestWorld;
+	TArray<AOUUExampleCharacter*> Bots;
+	Bots.Reserve(NumBots);
+	for (int32 Index = 0; Index < NumBots; ++Index)
+	{
+		Bots.Add(TestWorld.Get().SpawnActor<AOUUExampleCharacter>());
+	}
+
+	FRandomStream RandomStream(42);
+	int64 NumDirtyProperties = 0;
+	const double FrameSeconds = MeasureAverageSeconds(TEXT("Push model soak frame"), NumFrames, [&]() {
+		for (AOUUExampleCharacter* Bot : Bots)
+		{
+			if (RandomStream.FRand() < ScoreChance)
+			{
+				Bot->SetScore(Bot->GetScore() + 1);
+				++NumDirtyProperties;
+			}
+			if (RandomStream.FRand() < ColorChance)
+			{
+				const auto NewColor = static_cast<EOUUExampleBodyPartColor>(
+					RandomStream.RandHelper(static_cast<int32>(EOUUExampleBodyPartColor::Count)));
+				const int32 BodyPartIndex = RandomStream.RandHelper(AOUUExampleCharacter::NumBodyParts);
+				if (Bot->GetBodyPartColor(BodyPartIndex) != NewColor)
+				{
+					Bot->ColorBodyPartByIndex(BodyPartIndex, NewColor);
+					++NumDirtyProperties;
+				}
+			}
+		}
+		TestWorld.Tick();
+	});
+
+	AddInfo(FString::Printf(
+		TEXT("%i bots over %i frames: %s per frame, compared properties per net update: %i without push model, "
+			 "%.1f with push model"),
+		NumBots,
+		NumFrames,
+		*FPlatformTime::PrettyTime(FrameSeconds),
+		NumBots * NumPushModelProperties,
+		static_cast<double>(NumDirtyProperties) / NumFrames));
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardBodyPartColorBandwidthPerfTest,
+	"OUUCodingStandard.Character.BodyPartColorBandwidth.Performance",
+	OUU::CodingStandard::Tests::PerfTestFlags)
+
+bool FOUUCodingStandardBodyPartColorBandwidthPerfTest::RunTest(const FString& Parameters)
+{
+	// Replays the same random color changes through the wire layout of both replication strategies:
+	// - Per property: a packed property handle and a full byte for every changed color property.
+	// - Fast array: a packed property handle and the four int32 fields of the delta header per changed array,
+	//   followed by the int32 replication ID and the bit-packed NetSerialize() payload of every changed item.
+	// The test world has no net driver, so packet and bunch headers are not included for either strategy.
+	constexpr int32 NumCharacters = 100;
+	constexpr int32 NumNetUpdates = 300;
+	constexpr int32 NetUpdatesPerSecond = 30;
+	constexpr float ChangeChance = 0.1f;
+
+	FRandomStream RandomStream(42);
+	FBitWriter PerPropertyWriter(0, true);
+	FBitWriter FastArrayWriter(0, true);
+	for (int32 NetUpdate = 0; NetUpdate < NumNetUpdates; ++NetUpdate)
+	{
+		for (int32 CharacterIndex = 0; CharacterIndex < NumCharacters; ++CharacterIndex)
+		{
+			TArray<FOUUExampleBodyPartColorItem, TInlineAllocator<AOUUExampleCharacter::NumBodyParts>> ChangedItems;
+			for (int32 BodyPartIndex = 0; BodyPartIndex < AOUUExampleCharacter::NumBodyParts; ++BodyPartIndex)
+			{
+				if (RandomStream.FRand() >= ChangeChance)
+					continue;
+
+				FOUUExampleBodyPartColorItem& Item = ChangedItems.AddDefaulted_GetRef();
+				Item.BodyPartIndex = static_cast<uint8>(BodyPartIndex);
+				Item.BodyPartColor = static_cast<EOUUExampleBodyPartColor>(
+					RandomStream.RandHelper(static_cast<int32>(EOUUExampleBodyPartColor::Count)));
+
+				uint32 PropertyHandle = static_cast<uint32>(BodyPartIndex) + 1;
+				uint8 ColorByte = static_cast<uint8>(Item.BodyPartColor);
+				PerPropertyWriter.SerializeIntPacked(PropertyHandle);
+				PerPropertyWriter << ColorByte;
+			}
+
+			if (ChangedItems.Num() == 0)
+				continue;
+
+			uint32 PropertyHandle = 1;
+			int32 ArrayReplicationKey = NetUpdate;
+			int32 BaseReplicationKey = NetUpdate - 1;
+			int32 NumDeleted = 0;
+			int32 NumChanged = ChangedItems.Num();
+			FastArrayWriter.SerializeIntPacked(PropertyHandle);
+			FastArrayWriter << ArrayReplicationKey << BaseReplicationKey << NumDeleted << NumChanged;
+			for (FOUUExampleBodyPartColorItem& Item : ChangedItems)
+			{
+				int32 ReplicationID = Item.BodyPartIndex;
+				FastArrayWriter << ReplicationID;
+				bool bSuccess = false;
+				Item.NetSerialize(FastArrayWriter, nullptr, bSuccess);
+			}
+		}
+	}
+
+	const auto BytesPerSecond = [&](const FBitWriter& Writer) {
+		return static_cast<double>(Writer.GetNumBytes()) * NetUpdatesPerSecond / NumNetUpdates;
+	};
+	AddInfo(FString::Printf(
+		TEXT("%i characters with %i body parts at %i net updates/s: per property %.0f bytes/s, "
+			 "fast array %.0f bytes/s"),
+		NumCharacters,
+		AOUUExampleCharacter::NumBodyParts,
+		NetUpdatesPerSecond,
+		BytesPerSecond(PerPropertyWriter),
+		BytesPerSecond(FastArrayWriter)));
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardServerDataRateLimitTest,
+	"OUUCodingStandard.Character.ServerDataRateLimit",
+	OUU::CodingStandard::Tests::TestFlags)
+
+bool FOUUCodingStandardServerDataRateLimitTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	IConsoleVariable* TokensPerSecondCVar =
+		IConsoleManager::Get().FindConsoleVariable(TEXT("ouu.CodingStandard.ServerDataRateLimit.TokensPerSecond"));
+	IConsoleVariable* BurstSizeCVar =
+		IConsoleManager::Get().FindConsoleVariable(TEXT("ouu.CodingStandard.ServerDataRateLimit.BurstSize"));
+	if (!TestNotNull(TEXT("TokensPerSecond cvar"), TokensPerSecondCVar)
+		|| !TestNotNull(TEXT("BurstSize cvar"), BurstSizeCVar))
+		return false;
+
+	const float TokensPerSecondBefore = TokensPerSecondCVar->GetFloat();
+	const float BurstSizeBefore = BurstSizeCVar->GetFloat();
+	ON_SCOPE_EXIT
+	{
+		TokensPerSecondCVar->Set(TokensPerSecondBefore);
+		BurstSizeCVar->Set(BurstSizeBefore);
+	};
+
+	constexpr int32 TokensPerSecond = 10;
+	constexpr int32 BurstSize = 5;
+	TokensPerSecondCVar->Set(static_cast<float>(TokensPerSecond));
+	BurstSizeCVar->Set(static_cast<float>(BurstSize));
+
+	// The server RPC runs locally in the standalone test world, so the rate limit applies right away.
+	const FScopedTestWorld TestWorld;
+	auto* Character = TestWorld.Get().SpawnActor<AOUUExampleCharacter>();
+	if (!TestNotNull(TEXT("Spawned character"), Character))
+		return false;
+
+	// A client spamming the RPC 10 times per frame for 5 seconds at 60 FPS.
+	constexpr int32 NumFrames = 300;
+	constexpr int32 CallsPerFrame = 10;
+	constexpr float DeltaSeconds = 1.f / 60.f;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		for (int32 Call = 0; Call < CallsPerFrame; ++Call)
+		{
+			Character->SendDataToServer();
+		}
+		TestWorld.Tick(DeltaSeconds);
+	}
+
+	// Coalescing leaves one RPC per frame, of which the server processes the burst plus the refill rate.
+	const int32 NumProcessed = NumFrames - Character->GetNumDroppedServerRPCs();
+	const int32 ExpectedNumProcessed = BurstSize + FMath::FloorToInt32(NumFrames * DeltaSeconds * TokensPerSecond);
+	TestTrue(
+		FString::Printf(TEXT("Processed %i RPCs, expected %i +-1"), NumProcessed, ExpectedNumProcessed),
+		FMath::Abs(NumProcessed - ExpectedNumProcessed) <= 1);
+	AddInfo(FString::Printf(
+		TEXT("%i calls over %i frames: %i merged, %i processed, %i dropped"),
+		NumFrames * CallsPerFrame,
+		NumFrames,
+		NumFrames * (CallsPerFrame - 1),
+		NumProcessed,
+		Character->GetNumDroppedServerRPCs()));
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardCharacterPoolReactivationTest,
+	"OUUCodingStandard.Subsystem.CharacterPool.Reactivation",
+	OUU::CodingStandard::Tests::TestFlags)
+
+bool FOUUCodingStandardCharacterPoolReactivationTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	const FScopedTestWorld TestWorld;
+	auto* Subsystem = TestWorld.Get().GetSubsystem<UOUUExampleCharacterSubsystem>();
+	if (!TestNotNull(TEXT("Character subsystem"), Subsystem))
+		return false;
+
+	auto* Character = Subsystem->AcquireCharacter(nullptr, FTransform::Identity);
+	if (!TestNotNull(TEXT("Acquired character"), Character))
+		return false;
+
+	TInlineComponentArray<USkeletalMeshComponent*> MeshComponents(Character);
+	USkeletalMeshComponent* const* HeadMeshComponent = MeshComponents.FindByPredicate(
+		[Character](const USkeletalMeshComponent* MeshComponent) { return MeshComponent != Character->GetMesh(); });
+	if (!TestNotNull(TEXT("Head mesh component"), HeadMeshComponent))
+		return false;
+
+	const bool bHeadTicksInitially = (*HeadMeshComponent)->IsComponentTickEnabled();
+	auto* PlayerController = TestWorld.Get().SpawnActor<APlayerController>();
+	PlayerController->Possess(Character);
+	Character->SendDataToServer();
+
+	Subsystem->ReleaseCharacter(*Character);
+	TestFalse(TEXT("Pooled body mesh ticks"), Character->GetMesh()->IsComponentTickEnabled());
+	TestFalse(TEXT("Pooled head mesh ticks"), (*HeadMeshComponent)->IsComponentTickEnabled());
+	TestNull(TEXT("Controller of the pooled character"), Character->GetController());
+	TestTrue(TEXT("Pooled character is dormant"), Character->NetDormancy == DORM_DormantAll);
+
+	// The queued server data of the previous use is dropped with the character's entry in the end of frame queue.
+	TestWorld.Tick();
+	TestFalse(TEXT("Pooled body mesh ticks after a frame"), Character->GetMesh()->IsComponentTickEnabled());
+
+	auto* ReacquiredCharacter = Subsystem->AcquireCharacter(nullptr, FTransform::Identity);
+	if (!TestTrue(TEXT("Character is reused from the pool"), ReacquiredCharacter == Character))
+		return false;
+
+	TestTrue(TEXT("Reactivated body mesh ticks"), Character->GetMesh()->IsComponentTickEnabled());
+	TestEqual(
+		TEXT("Reactivated head mesh ticks like a fresh character"),
+		(*HeadMeshComponent)->IsComponentTickEnabled(),
+		bHeadTicksInitially);
+	TestFalse(TEXT("Reactivated character is hidden"), Character->IsHidden());
+	TestTrue(TEXT("Reactivated character is awake"), Character->NetDormancy == DORM_Awake);
+	TestEqual(TEXT("Reactivated character dropped RPCs"), Character->GetNumDroppedServerRPCs(), 0);
+
+	TestWorld.Tick();
+	TestTrue(TEXT("Body mesh still ticks after a frame"), Character->GetMesh()->IsComponentTickEnabled());
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardHeadLeaderPosePerfTest,
+	"OUUCodingStandard.Character.HeadLeaderPose.Performance",
+	OUU::CodingStandard::Tests::PerfTestFlags)
+
+bool FOUUCodingStandardHeadLeaderPosePerfTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	// The engine's skeletal cube gives both meshes real bones to evaluate.
+	auto* SkeletalMesh = LoadObject<USkeletalMesh>(nullptr, TEXT("/Engine/EngineMeshes/SkeletalCube.SkeletalCube"));
+	if (!TestNotNull(TEXT("Skeletal cube mesh"), SkeletalMesh))
+		return false;
+
+	constexpr int32 NumCharacters = 200;
+	constexpr int32 NumFrames = 60;
+	const FScopedTestWorld TestWorld;
+	TArray<USkeletalMeshComponent*> HeadMeshComponents;
+	for (int32 Index = 0; Index < NumCharacters; ++Index)
+	{
+		auto* Character = TestWorld.Get().SpawnActor<AOUUExampleCharacter>();
+		TInlineComponentArray<USkeletalMeshComponent*> MeshComponents(Character);
+		for (USkeletalMeshComponent* MeshComponent : MeshComponents)
+		{
+			MeshComponent->SetSkeletalMesh(SkeletalMesh);
+			// Nothing is rendered in the test world, so the poses would not be refreshed otherwise.
+			MeshComponent->VisibilityBasedAnimTickOption =
+				EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+			if (MeshComponent != Character->GetMesh())
+			{
+				HeadMeshComponents.Add(MeshComponent);
+			}
+		}
+	}
+
+	// Both runs are named events, so the anim evaluation of each can be compared in an Insights trace.
+	const double LeaderPoseSeconds = MeasureAverageSeconds(TEXT("Tick with leader pose head"), NumFrames, [&]() {
+		TestWorld.Tick();
+	});
+
+	// Restore the setup without leader pose: the head evaluates its own pose in its own tick.
+	for (USkeletalMeshComponent* HeadMeshComponent : HeadMeshComponents)
+	{
+		HeadMeshComponent->SetLeaderPoseComponent(nullptr);
+		HeadMeshComponent->SetComponentTickEnabled(true);
+	}
+	const double SeparateSeconds = MeasureAverageSeconds(TEXT("Tick with animated head"), NumFrames, [&]() {
+		TestWorld.Tick();
+	});
+
+	AddInfo(FString::Printf(
+		TEXT("World tick with %i characters: leader pose head %s, animated head %s"),
+		NumCharacters,
+		*FPlatformTime::PrettyTime(LeaderPoseSeconds),
+		*FPlatformTime::PrettyTime(SeparateSeconds)));
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOUUCodingStandardSignificancePerfTest,
+	"OUUCodingStandard.Character.Significance.Performance",
+	OUU::CodingStandard::Tests::PerfTestFlags)
+
+bool FOUUCodingStandardSignificancePerfTest::RunTest(const FString& Parameters)
+{
+	using namespace OUU::CodingStandard::Tests;
+
+	IConsoleVariable* UpdateManagerCVar =
+		IConsoleManager::Get().FindConsoleVariable(TEXT("ouu.CodingStandard.Significance.UpdateManager"));
+	if (!TestNotNull(TEXT("UpdateManager cvar"), UpdateManagerCVar))
+		return false;
+
+	const bool bUpdateManagerBefore = UpdateManagerCVar->GetBool();
+	ON_SCOPE_EXIT
+	{
+		UpdateManagerCVar->Set(bUpdateManagerBefore);
+	};
+
+	// 500 characters spread over all significance buckets around a single player, like in a crowded test map.
+	constexpr int32 NumCharacters = 500;
+	constexpr int32 NumFrames = 120;
+	const FScopedTestWorld TestWorld;
+	auto* Subsystem = TestWorld.Get().GetSubsystem<UOUUExampleCharacterSubsystem>();
+	if (!TestNotNull(TEXT("Character subsystem"), Subsystem))
+		return false;
+
+	FRandomStream RandomStream(42);
+	TArray<AOUUExampleCharacter*> Characters;
+	for (int32 Index = 0; Index < NumCharacters; ++Index)
+	{
+		const FVector Location = RandomStream.VRand() * RandomStream.FRandRange(0.f, 15000.f);
+		Characters.Add(TestWorld.Get().SpawnActor<AOUUExampleCharacter>(Location, FRotator::ZeroRotator));
+	}
+	TestWorld.Get().SpawnActor<APlayerController>();
+
+	// Awesomeness changes every frame, so the deferred events of less significant characters are actually saved.
+	const auto TickWithAwesomenessChanges = [&]() {
+		for (AOUUExampleCharacter* Character : Characters)
+		{
+			Character->SetAwesomeness(RandomStream.RandRange(-1000, 1000));
+		}
+		TestWorld.Tick();
+	};
+
+	// Without manager updates all characters stay in the most significant bucket.
+	UpdateManagerCVar->Set(false);
+	const double FullRateSeconds =
+		MeasureAverageSeconds(TEXT("Frames at full rate"), NumFrames, TickWithAwesomenessChanges);
+
+	UpdateManagerCVar->Set(true);
+	TestWorld.Tick();
+	const auto NumCharactersBySignificance = Subsystem->CountCharactersBySignificance();
+	const double BucketedSeconds =
+		MeasureAverageSeconds(TEXT("Frames by significance"), NumFrames, TickWithAwesomenessChanges);
+
+	if (NumCharactersBySignificance[0] == NumCharacters)
+	{
+		AddWarning(TEXT("No significance manager in the test world, so all characters stayed highly significant"));
+	}
+
+	FString BucketCounts;
+	for (const int32 NumBucketCharacters : NumCharactersBySignificance)
+	{
+		const TCHAR* Separator = BucketCounts.IsEmpty() ? TEXT("") : TEXT("/");
+		BucketCounts += FString::Printf(TEXT("%s%i"), Separator, NumBucketCharacters);
+	}
+	AddInfo(FString::Printf(
+		TEXT("%i characters (%s per bucket): %s per frame at full rate, %s per frame by significance"),
+		NumCharacters,
+		*BucketCounts,
+		*FPlatformTime::PrettyTime(FullRateSeconds),
+		*FPlatformTime::PrettyTime(BucketedSeconds)));
+	return true;
+}
+
+#endif
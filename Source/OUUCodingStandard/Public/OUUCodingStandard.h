@@ -95,9 +95,19 @@
 
 // [include.root] Never use include paths relative to your file. This also applies to source files, but especially so to
 // header files. Instead, make the include paths relative to the Public/ or Classes/ directory of the source module.
+#include "Containers/StaticArray.h"
+#include "CoreGlobals.h"
 #include "GameFramework/Character.h"
+#include "GameFramework/Info.h"
 #include "GameFramework/Pawn.h"
 #include "Misc/EnumRange.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Templates/MemoryOps.h"
+#include "Templates/PimplPtr.h"
+#include "Templates/TypeCompatibleBytes.h"
+
+#include <type_traits>
 
 // [include.generated] Include the generated header file last.
 #include "OUUCodingStandard.generated.h"
@@ -105,7 +115,13 @@
 //---------------------------------------------------------------------------------------------------------------------
 // [header.fwd] Use forward-declarations instead of includes wherever possible.
 // Forward declarations should always be made here instead of inline.
+class AOUUExampleCharacter;
+class UOUUExampleCharacterSubsystem;
+class UOUUExampleCrowdAwesomenessProcessor;
 class USkeletalMeshComponent;
+struct FMassEntityHandle;
+struct FMassEntityManager;
+struct FOUUExampleCrowd;
 
 // [macro.decl] Macro based declarations that do not rely on types declared in the header file itself should always come
 // first after forward-declarations. Otherwise immediately after the related type.
@@ -153,6 +169,188 @@ enum class EOUUExampleBodyPartColor : uint8
 // -> see [enum.range.use]
 ENUM_RANGE_BY_COUNT(EOUUExampleBodyPartColor, EOUUExampleBodyPartColor::Count);
 
+/**
+ * Update frequency bucket of example characters, ordered from most to least significant.
+ * Assigned by the significance manager based on the distance to the closest viewpoint and on visibility.
+ */
+UENUM()
+enum class EOUUExampleCharacterSignificance : uint8
+{
+	High,
+	Medium,
+	Low,
+	Lowest,
+
+	Count UMETA(Hidden)
+};
+
+/**
+ * Color preset to apply to a single body part of a colorable.
+ */
+USTRUCT(BlueprintType)
+struct FOUUExampleBodyPartColorEntry
+{
+	GENERATED_BODY()
+public:
+	FOUUExampleBodyPartColorEntry() = default;
+
+	FOUUExampleBodyPartColorEntry(FName InBodyPartName, EOUUExampleBodyPartColor InBodyPartColor) :
+		BodyPartName(InBodyPartName), BodyPartColor(InBodyPartColor)
+	{
+	}
+
+	// Name ID of the body part to be colored.
+	UPROPERTY(BlueprintReadWrite)
+	FName BodyPartName;
+
+	// Color preset to apply to the body part.
+	UPROPERTY(BlueprintReadWrite)
+	EOUUExampleBodyPartColor BodyPartColor = EOUUExampleBodyPartColor::Red;
+};
+
+/**
+ * A single body part color change of a colorable.
+ */
+USTRUCT(BlueprintType)
+struct FOUUExampleBodyPartColorChange
+{
+	GENERATED_BODY()
+public:
+	FOUUExampleBodyPartColorChange() = default;
+
+	FOUUExampleBodyPartColorChange(
+		FName InBodyPartName,
+		EOUUExampleBodyPartColor InOldBodyPartColor,
+		EOUUExampleBodyPartColor InNewBodyPartColor) :
+		BodyPartName(InBodyPartName), OldBodyPartColor(InOldBodyPartColor), NewBodyPartColor(InNewBodyPartColor)
+	{
+	}
+
+	// Name ID of the body part that was re-colored.
+	UPROPERTY(BlueprintReadOnly)
+	FName BodyPartName;
+
+	// Color preset that was applied before the change.
+	UPROPERTY(BlueprintReadOnly)
+	EOUUExampleBodyPartColor OldBodyPartColor = EOUUExampleBodyPartColor::Red;
+
+	// Color preset that is applied now.
+	UPROPERTY(BlueprintReadOnly)
+	EOUUExampleBodyPartColor NewBodyPartColor = EOUUExampleBodyPartColor::Red;
+};
+
+/**
+ * Handle of an actor-less crowd member -> see UOUUExampleCharacterSubsystem::AddCrowdMember()
+ * Crowd members are Mass entities, but Mass is an implementation detail of the module. The handle mirrors the entity
+ * handle, so modules that include this header don't need the Mass headers.
+ */
+struct FOUUExampleCrowdMemberHandle
+{
+	FOUUExampleCrowdMemberHandle() = default;
+
+	FOUUExampleCrowdMemberHandle(int32 InIndex, int32 InSerialNumber) : Index(InIndex), SerialNumber(InSerialNumber)
+	{
+	}
+
+	// @returns true if the handle was set by AddCrowdMember(). The crowd member may still be gone since.
+	explicit operator bool() const;
+
+	friend bool operator==(FOUUExampleCrowdMemberHandle LHS, FOUUExampleCrowdMemberHandle RHS);
+	friend bool operator!=(FOUUExampleCrowdMemberHandle LHS, FOUUExampleCrowdMemberHandle RHS);
+
+	int32 Index = 0;
+	int32 SerialNumber = 0;
+};
+
+inline FOUUExampleCrowdMemberHandle::operator bool() const
+{
+	return Index != 0 && SerialNumber != 0;
+}
+
+inline bool operator==(FOUUExampleCrowdMemberHandle LHS, FOUUExampleCrowdMemberHandle RHS)
+{
+	return LHS.Index == RHS.Index && LHS.SerialNumber == RHS.SerialNumber;
+}
+
+inline bool operator!=(FOUUExampleCrowdMemberHandle LHS, FOUUExampleCrowdMemberHandle RHS)
+{
+	return !(LHS == RHS);
+}
+
+struct FOUUExampleBodyPartColorArray;
+
+/**
+ * Replicated color of a single body part -> see FOUUExampleBodyPartColorArray
+ */
+USTRUCT()
+struct FOUUExampleBodyPartColorItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+public:
+	// Index of the body part in the body part tables of the owning character.
+	UPROPERTY()
+	uint8 BodyPartIndex = 0;
+
+	UPROPERTY()
+	EOUUExampleBodyPartColor BodyPartColor = EOUUExampleBodyPartColor::Red;
+
+	// [net.fastarray] Fast array item callbacks are only called on clients and do not need to be virtual.
+	void PostReplicatedAdd(const FOUUExampleBodyPartColorArray& InArraySerializer);
+	void PostReplicatedChange(const FOUUExampleBodyPartColorArray& InArraySerializer);
+
+	// [net.serialize] Consider custom NetSerialize functions that bit-pack values with a known small range.
+	// Both fields are serialized with the minimum number of bits for NumBodyParts and EOUUExampleBodyPartColor::Count
+	// respectively instead of a full byte each.
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FOUUExampleBodyPartColorItem> :
+	public TStructOpsTypeTraitsBase2<FOUUExampleBodyPartColorItem>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
+/**
+ * Delta replicated body part colors of a character.
+ * Only entries that were marked dirty are sent, so the cost scales with the number of changed body parts instead of
+ * the total number of body parts.
+ */
+USTRUCT()
+struct FOUUExampleBodyPartColorArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	TArray<FOUUExampleBodyPartColorItem> Items;
+
+	// Character that owns this array and receives the client side item callbacks.
+	// Assigned in AOUUExampleCharacter::PostInitializeComponents(), because assigning it in the constructor would be
+	// overwritten by the value copied from the archetype, which points to the archetype itself.
+	AOUUExampleCharacter* OwningCharacter = nullptr;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParams)
+	{
+		return FastArrayDeltaSerialize<FOUUExampleBodyPartColorItem, FOUUExampleBodyPartColorArray>(
+			Items,
+			DeltaParams,
+			*this);
+	}
+};
+
+template <>
+struct TStructOpsTypeTraits<FOUUExampleBodyPartColorArray> :
+	public TStructOpsTypeTraitsBase2<FOUUExampleBodyPartColorArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
 // [doc.delegate.type] Prefer documenting the meaning of parameters at the delegate type declaration over documenting
 // the parameters at the delegate instance. This makes it easier to reuse the same delegate without duplicating docs.
 /**
@@ -169,6 +367,26 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(
 	EOUUExampleBodyPartColor,
 	NewBodyPartColor);
 
+/**
+ * @param	BodyPartColorChanges	All body part color changes that were applied together.
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(
+	FOnExampleColorablePartColorsChanged,
+	const TArray<FOUUExampleBodyPartColorChange>&,
+	BodyPartColorChanges);
+
+// [delegate.native] Dynamic delegates are invoked via reflection, which is a lot slower than native delegates.
+// For events that are raised in hot paths, offer a native counterpart with the same payload for C++ listeners.
+// The parameter docs of the dynamic delegates above apply.
+DECLARE_MULTICAST_DELEGATE_ThreeParams(
+	FOnExampleColorablePartColorChangedNative,
+	FName,
+	EOUUExampleBodyPartColor,
+	EOUUExampleBodyPartColor);
+DECLARE_MULTICAST_DELEGATE_OneParam(
+	FOnExampleColorablePartColorsChangedNative,
+	TConstArrayView<FOUUExampleBodyPartColorChange>);
+
 // [naming.interface.uclass] Same as the corresponding IInterface class but with changed type prefix (U instead of I).
 // [doc.interface.uclass] The UInterface does not need a type comment, as it's mainly required for the reflection data.
 // [interface.cpponly] Mark interfaces as CannotImplementInterfaceInBlueprint if possible.
@@ -197,6 +415,16 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable)
 	virtual bool ColorBodyPart(FName BodyPartName, EOUUExampleBodyPartColor BodyPartColor) = 0;
+
+	/**
+	 * Color multiple body parts at once, e.g. to apply a whole outfit.
+	 * Implementations should apply all colors before notifying listeners about the changes.
+	 * Takes a view instead of a map, so callers can pass an inline or static array without hashing or allocating.
+	 * Not exposed to Blueprint, because reflection does not support array views.
+	 * @param		BodyPartColors	Color preset to apply per body part name ID.
+	 * @returns		true if all body parts were found and successfully colored.
+	 */
+	virtual bool ColorBodyParts(TConstArrayView<FOUUExampleBodyPartColorEntry> BodyPartColors) = 0;
 };
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -210,6 +438,20 @@ enum class EAwesomenessLevel
 	NumOf
 };
 
+namespace OUU::CodingStandard::Private
+{
+	// Names of all valid EAwesomenessLevel cases, indexed by the enum value.
+	// TEXTVIEW() is the FStringView counterpart of the TEXT() macro -> see [string.literal]
+	inline constexpr FStringView AwesomenessLevelNames[] = {
+		TEXTVIEW("NotAwesome"),
+		TEXTVIEW("SemiAwesome"),
+		TEXTVIEW("Awesome")};
+
+	static_assert(
+		static_cast<int32>(UE_ARRAY_COUNT(AwesomenessLevelNames)) == static_cast<int32>(EAwesomenessLevel::NumOf),
+		"AwesomenessLevelNames must have one entry per valid EAwesomenessLevel case");
+} // namespace OUU::CodingStandard::Private
+
 // [namespace] Reflected types (uclass, ustruct, uenum, etc) cannot be put into namespaces.
 // Everything else should be put into namespaces, especially free functions that could otherwise result in name clashes.
 // Use the following namespace structure: OUU::ModuleName or OUU::ModuleName::Private
@@ -217,14 +459,37 @@ namespace OUU::CodingStandard
 {
 	EAwesomenessLevel AwesomenessLevelFromIntValue(int32 Awesomeness);
 
+	/**
+	 * Batch version of AwesomenessLevelFromIntValue() for large amounts of awesomeness values.
+	 * Uses a vectorized kernel on platforms with vector intrinsics and a scalar fallback everywhere else.
+	 * @param	Awesomeness			Numeric awesomeness values to convert.
+	 * @param	OutAwesomenessLevels	Receives the level for each input value. Must have the same size as the input.
+	 */
+	void AwesomenessLevelsFromIntValues(
+		TArrayView<const int32> Awesomeness,
+		TArrayView<EAwesomenessLevel> OutAwesomenessLevels);
+
 	// [string.conv] Overload the LexToString/TryLexFromString for custom primitive string conversion instead of
 	// coming up with own names.
 	// [naming.func.param.in] Optionally prefix function input parameters with 'In' to distinguish them from locals and
 	// members.
 	FString LexToString(EAwesomenessLevel InAwesomenessLevel);
 
+	// [string.conv.view] Provide an allocation-free FStringView variant for conversions that may be used in hot paths
+	// (e.g. logging or UI) and implement the FString overload as a thin wrapper around it.
+	/**
+	 * Allocation-free version of LexToString().
+	 * @returns		a view to a static string literal, "<invalid>" for out of range values.
+	 */
+	constexpr FStringView LexToStringView(EAwesomenessLevel InAwesomenessLevel);
+
 	// [naming.func.param.out] Always prefix out-by-ref-parameters with 'Out'.
-	bool TryLexFromString(EAwesomenessLevel& OutAwesomenessLevel, const FString& String);
+	/**
+	 * Parse an awesomeness level from its name (case insensitive). NumOf is not accepted.
+	 * Takes a string view, so callers can parse substrings of larger buffers without copying them into an FString.
+	 * @returns		true if String matched one of the level names.
+	 */
+	bool TryLexFromString(EAwesomenessLevel& OutAwesomenessLevel, FStringView String);
 
 	/**
 	 * Track how awesome a character is.
@@ -237,7 +502,7 @@ namespace OUU::CodingStandard
 		FNumericAwesomeness() = default;
 
 		// [ctor.initializer.inline] An initializing constructor may be inlined.
-		FNumericAwesomeness(int32 InAwesomeness, const FString& InAwesomenessReason) :
+		FNumericAwesomeness(int32 InAwesomeness, FName InAwesomenessReason) :
 			AwesomenessReason(InAwesomenessReason), Awesomeness(InAwesomeness)
 		{
 		}
@@ -245,7 +510,8 @@ namespace OUU::CodingStandard
 		// [ctor.delegate] Delegate parameter constructors to a single one that takes all of them, unless impossible.
 		// [ctor.explicit] Single-argument constructors must be declared as explicit unless implicit conversion is
 		// specifically wanted. In that case, this conversion behavior needs to be documented.
-		explicit FNumericAwesomeness(int32 InAwesomeness) : FNumericAwesomeness(InAwesomeness, TEXT("unknown reason"))
+		explicit FNumericAwesomeness(int32 InAwesomeness) :
+			FNumericAwesomeness(InAwesomeness, UnknownAwesomenessReason)
 		{
 		}
 
@@ -256,8 +522,12 @@ namespace OUU::CodingStandard
 		friend bool operator==(const FNumericAwesomeness& LHS, const FNumericAwesomeness& RHS);
 		friend bool operator<(const FNumericAwesomeness& LHS, const FNumericAwesomeness& RHS);
 
-		// Why the character is so awesome
-		FString AwesomenessReason = TEXT("");
+		// Reason used when none was given
+		static OUUCODINGSTANDARD_API const FName UnknownAwesomenessReason;
+
+		// Why the character is so awesome.
+		// Reasons are a small fixed set of names, so an FName keeps copying the struct free of string allocations.
+		FName AwesomenessReason = NAME_None;
 
 		// [struct.functions] Structs may only have constructor, operator and conversion functions.
 		// If it gets any more complicated than that, you should declare them as class instead.
@@ -265,6 +535,10 @@ namespace OUU::CodingStandard
 		// Get this character's numeric awesomeness converted to a fixed-step level.
 		EAwesomenessLevel GetAwesomenessLevel() const;
 
+		// [struct.conversion] Conversion operators must be explicit unless implicit conversion is specifically wanted.
+		// -> see [ctor.explicit]
+		explicit operator int32() const;
+
 	private:
 		// How awesome the character is
 		int32 Awesomeness = 0;
@@ -278,6 +552,20 @@ namespace OUU::CodingStandard
 		return AwesomenessLevelFromIntValue(Awesomeness);
 	}
 
+	inline FNumericAwesomeness::operator int32() const
+	{
+		return Awesomeness;
+	}
+
+	constexpr FStringView LexToStringView(EAwesomenessLevel InAwesomenessLevel)
+	{
+		const int32 Index = static_cast<int32>(InAwesomenessLevel);
+		if (Index < 0 || Index >= static_cast<int32>(EAwesomenessLevel::NumOf))
+			return TEXTVIEW("<invalid>");
+
+		return Private::AwesomenessLevelNames[Index];
+	}
+
 	inline bool operator==(const FNumericAwesomeness& LHS, const FNumericAwesomeness& RHS)
 	{
 		return LHS.Awesomeness == RHS.Awesomeness;
@@ -292,6 +580,65 @@ namespace OUU::CodingStandard
 	// renames, so you should keep an open eye.
 } // namespace OUU::CodingStandard
 
+//---------------------------------------------------------------------------------------------------------------------
+namespace OUU::CodingStandard::Templates::Private
+{
+	// Element types whose equality is bitwise equality and that fill whole vector lanes.
+	// This excludes floating point types (because of NaN and -0) and structs with custom comparison operators.
+	// NOTE: The std type traits are an exception to [basic.stl], because the UE counterparts are deprecated.
+	template <typename ElementType>
+	struct TCanUseVectorizedFind
+	{
+		static constexpr bool Value =
+			(std::is_integral_v<ElementType> || std::is_enum_v<ElementType> || std::is_pointer_v<ElementType>)
+			&& (sizeof(ElementType) == 1 || sizeof(ElementType) == 2 || sizeof(ElementType) == 4
+				|| sizeof(ElementType) == 8);
+	};
+
+	// Unsigned integer type with the same size as the element type.
+	template <SIZE_T NumBytes>
+	struct TVectorizedFindBits;
+	template <>
+	struct TVectorizedFindBits<1>
+	{
+		using Type = uint8;
+	};
+	template <>
+	struct TVectorizedFindBits<2>
+	{
+		using Type = uint16;
+	};
+	template <>
+	struct TVectorizedFindBits<4>
+	{
+		using Type = uint32;
+	};
+	template <>
+	struct TVectorizedFindBits<8>
+	{
+		using Type = uint64;
+	};
+
+	// Linear search that compares 32 (AVX2) or 16 (SSE2) bytes per step. Falls back to a scalar loop for the remainder
+	// and on platforms without x86 vector intrinsics.
+	// The kernels are defined in the cpp file, so the intrinsic headers don't leak into every file including this one.
+	OUUCODINGSTANDARD_API int32 VectorizedFindBits(const uint8* Data, int32 Num, uint8 Item);
+	OUUCODINGSTANDARD_API int32 VectorizedFindBits(const uint16* Data, int32 Num, uint16 Item);
+	OUUCODINGSTANDARD_API int32 VectorizedFindBits(const uint32* Data, int32 Num, uint32 Item);
+	OUUCODINGSTANDARD_API int32 VectorizedFindBits(const uint64* Data, int32 Num, uint64 Item);
+
+	template <typename ElementType>
+	int32 VectorizedFind(const ElementType* Data, int32 Num, const ElementType& Item)
+	{
+		static_assert(TCanUseVectorizedFind<ElementType>::Value, "Element type can't be compared bitwise");
+
+		using FBits = typename TVectorizedFindBits<sizeof(ElementType)>::Type;
+		FBits ItemBits;
+		FMemory::Memcpy(&ItemBits, &Item, sizeof(ItemBits));
+		return VectorizedFindBits(reinterpret_cast<const FBits*>(Data), Num, ItemBits);
+	}
+} // namespace OUU::CodingStandard::Templates::Private
+
 //---------------------------------------------------------------------------------------------------------------------
 // [namespace.nesting] Nested namespaces should receive an inline declaration in global scope instead of actually
 // nesting the scope braces. This makes it easier to move the namespaced declarations to a separate file and see the
@@ -303,8 +650,13 @@ namespace OUU::CodingStandard::Templates
 	// declaration
 	// [naming.template.paramtype] Parameter types should be suffixed with 'Type' or 'Types' in case of a parameter pack
 	// [template.paramtype] Parameter types should always use 'typename' instead of 'class'
+	/**
+	 * Small-buffer array that keeps up to DefaultSlack elements inline and spills all elements to memory of
+	 * AllocatorType once it grows beyond that. Like TArray, elements must be trivially relocatable.
+	 * Element order is preserved by all operations except RemoveAtSwap().
+	 */
 	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
-	struct TMyContainer
+	class TMyContainer
 	{
 	public:
 		// [naming.template.alias] No type prefix needed for the aliases.
@@ -314,146 +666,936 @@ namespace OUU::CodingStandard::Templates
 
 		// [static_assert] Use static assert in templates to improve compile safety and error verbosity
 		static_assert(DefaultSlack >= 8, "A default slack size of 8 or more is required, because xyz");
-	};
+		static_assert(
+			TAllocatorTraits<AllocatorType>::SupportsMove,
+			"Moving containers with spilled elements requires moving the allocation");
 
-} // namespace OUU::CodingStandard::Templates
+		TMyContainer() = default;
+		TMyContainer(const TMyContainer& Other);
+		TMyContainer(TMyContainer&& Other);
+		~TMyContainer();
 
-//---------------------------------------------------------------------------------------------------------------------
-/**
- * This is a sample character class that is not meant to be exported or used in other modules.
- */
-UCLASS()
-// [class.export] Add DLL export macros (here: OUUCODINGSTANDARD_API) to all types declared in headers that need
-// dynamic linkage.
-// [naming.class] Class names should be prefixed with Unreal prefix, then optionally the module prefix (OUU or project
-// prefix -> see [naming.modules]).
-// The unreal prefix depends on the type:
-// - T: Template classes and structs T.
-// - C: Concept traits -> see Template/Models.h
-// - U: Classes that inherit from UObject
-// - A: Classes that inherit from AActor
-// - S: Classes that inherit from SWidget
-// - I: Interface classes -> see [naming.iinterface]
-// - F: All other classes -> same as structs -> see [naming.struct]
-class OUUCODINGSTANDARD_API AOUUExampleCharacter : public ACharacter, public IOUUExampleColorableInterface
-{
-	// [order.members] Within any class/struct, members must be sorted by the following criteria in order:
-	// 1. Access Level -> see [order.access]
-	// 2. Nested categories (see items below)
-	//
-	// Categories are defined as follows:
-	// 1. Generated body macros -> see [macro.genbody]
-	// 2. Types, aliases and constants
-	//     2.1 Enums
-	//     2.2 Structs
-	//     2.3 Classes
-	//     2.4 Aliases
-	//     2.5 Constants
-	// 3. Constructors, destructors
-	//     3.1 Default constructor
-	//     3.2 Custom constructor
-	//     3.3 Copy/move constructors
-	//     3.4 Destructor
-	// 4. Member functions
-	//     4.1 Non-static, non-overridden, non-operator member functions
-	//     4.2 Operators
-	//     4.3 Static functions
-	// 5. Interface functions / Overriden virtual functions
-	//    Each base class counts as its own category (here: UObject, AActor, APawn, ACharacter,
-	//    IExampleColorableInterface) -> see [class.overrides]
-	// 6. Fields
-	//     6.1 Constant fields
-	//     6.2 Non-constant fields
+		TMyContainer& operator=(const TMyContainer& Other);
+		TMyContainer& operator=(TMyContainer&& Other);
 
-	// [macro.genbody] Use GENERATED_BODY() instead of the deprecated GENERATED_UCLASS_BODY(),
-	// GENERATED_IINTERFACE_BODY(), etc.
-	GENERATED_BODY()
+		ElementType& operator[](int32 Index);
+		const ElementType& operator[](int32 Index) const;
 
-	// [order.access] Order and group members by access level: public > protected > private.
-	// In total a class should therefore have max three access level specifiers.
-	// Always add an initial access level declaration after GENERATED_BODY().
-	// Do not rely on implicit access (i.e. struct = public, class = private).
-public:
-	// [alias.using] Use using declarations for aliasing instead of typedefs
-	// [naming.alias] Adopt the prefix of the aliased type, except for the following exceptions:
-	// - template type arguments -> see [naming.template.alias]
-	// - concrete template instantiations -> see [naming.alias.template.instance]
-	using FCharacterData = OUU::CodingStandard::FNumericAwesomeness;
+		int32 Num() const;
+		int32 Max() const;
+		bool IsEmpty() const;
+		bool IsValidIndex(int32 Index) const;
 
-	// [naming.alias.template.instance] When aliasing a template instance, use F as prefix, e.g.
-	using FCharacterMeshPtr = TWeakObjectPtr<USkeletalMeshComponent>;
+		ElementType* GetData();
+		const ElementType* GetData() const;
 
-	DECLARE_EVENT_OneParam(AOUUExampleCharacter, FOnAwesomenessChanged, EAwesomenessLevel);
-	FOnAwesomenessChanged OnAwesomenessChanged;
+		// @returns true if the elements are stored in the memory of AllocatorType instead of the inline storage.
+		bool HasSpilled() const;
 
-	// [member.constant.primitive] Primitive constants should be declared as constexpr, if possible.
-	// Prefer this any time over defines, c-style enums or static const values that are defined in cpp.
-	static constexpr int32 NumBodyParts = 2;
+		// Make sure there is space for at least NumElements without further allocations.
+		void Reserve(int32 NumElements);
 
-	// [member.constant.complex] Complex constants (like FNames) that cannot be declared as constexpr should be declared
-	// like this:
-	static const FName HeadBodyPartName;
-	static const FName TorsoBodyPartName;
+		// @returns the index of the added element.
+		int32 Add(const ElementType& Item);
+		int32 Add(ElementType&& Item);
 
-	// [uclass.ctor] Prefer the parameterless default constructor for UObjects instead of the one using
-	// FObjectInitializer.
-	AOUUExampleCharacter();
+		// Construct a new element in place at the end of the container.
+		// @returns the index of the new element.
+		template <typename... ArgTypes>
+		int32 Emplace(ArgTypes&&... Args);
 
-	AOUUExampleCharacter(USkeletalMesh* InSkeletalMesh, EOUUExampleBodyPartColor InHeadColor);
+		// Remove the element at the index and shift all following elements down by one.
+		void RemoveAt(int32 Index);
 
-	// [doc.delegate.instance] Do not duplicate parameter docs for delegate at the instance.
-	// Instad, focus on the things that changes between instances.
+		// Remove the element at the index and move the last element into its place. Does not preserve order.
+		void RemoveAtSwap(int32 Index);
 
-	// This is called for any body part that is re-colored.
-	// This delegate is called before the more specific OnXYColorChanged events below.
+		// Remove all elements that compare equal to the item.
+		// @returns the number of removed elements.
+		int32 Remove(const ElementType& Item);
 
-	// [naming.delegate.instance] Delegate instances are prefixed with 'On'. The name must be an event in past tense.
-	UPROPERTY(BlueprintAssignable)
-	FOnExampleColorablePartColorChanged OnBodyPartColorChanged;
+		// @returns the index of the first element that compares equal to the item or INDEX_NONE.
+		// Integral, enum and pointer elements are compared 16 or 32 bytes at a time with SSE2 or AVX2.
+		int32 Find(const ElementType& Item) const;
+		bool Contains(const ElementType& Item) const;
 
-	// [doc.omit] Omit doc comments that are obvious from the type/member naming.
-	// Restating the obvious just wastes space and time.
-	UPROPERTY(BlueprintAssignable)
-	FOnExampleColorablePartColorChanged OnHeadColorChanged;
+		// Destroy all elements, but keep the allocated memory.
+		void Reset();
 
-	UPROPERTY(BlueprintAssignable)
-	FOnExampleColorablePartColorChanged OnTorsoColorChanged;
+		// Destroy all elements and release the memory of AllocatorType, so elements are stored inline again.
+		void Empty();
 
-	// [member.accessor] Prefer declaring accessor functions (getters + setters) over making member field public.
-	EAwesomenessLevel GetAwesomenessLevel() const;
-	void SetAwesomeness(int32 Awesomeness);
+		// DO NOT USE DIRECTLY
+		// STL-like iterators to enable range-based for loop support.
+		ElementType* begin();
+		const ElementType* begin() const;
+		ElementType* end();
+		const ElementType* end() const;
 
-	// Checks if all possible colors are assigned to this character in any body part
-	bool HasAllColorsPossible() const;
+	private:
+		using FSecondaryData = typename AllocatorType::template ForElementType<ElementType>;
 
-	// [member.order.overrides] Overridden functions are grouped by the class where the function was first declared.
-	// Each group must start with a comment indicating the originating parent class.
-	// That is the parent class where the function was first declared.
+		TTypeCompatibleBytes<ElementType> InlineData[DefaultSlack];
+		FSecondaryData SecondaryData;
+		int32 ArrayNum = 0;
+		int32 ArrayMax = DefaultSlack;
 
-	// [member.virtual] Overriden virtual functions must be marked as either override or final.
-	// Do NOT use the virtual keyword.
+		ElementType* GetInlineData();
+		void CheckAddress(const ElementType* Address) const;
 
-	// [doc.member.virtual] Virtual overrides should not need to be documented as the API should be consistent with
-	// the initial declaration.
+		// Change the capacity to NewMax elements. NewMax must be larger than the current capacity.
+		void ResizeTo(int32 NewMax);
 
-	// -- AActor interface
-	void BeginPlay() override;
-	void EndPlay(EEndPlayReason::Type EndPlayReason) override;
+		// Forward to SecondaryData and pass the element alignment if the allocator supports it, like TArray does.
+		// Otherwise over-aligned elements would end up in memory with the default alignment of the allocator.
+		void ResizeSecondaryData(int32 CurrentNum, int32 NewMax);
+		int32 CalculateSlackReserve(int32 NewMax) const;
+		int32 CalculateSlackGrow(int32 NewMax) const;
 
-	// -- IOUUExampleColorableInterface
-	bool ColorBodyPart(FName BodyPartName, EOUUExampleBodyPartColor BodyPartColor) override;
+		// Take over the elements of Other, which must not be this container. This container must be empty.
+		void MoveFrom(TMyContainer& Other);
+	};
 
-protected:
-	// [naming.func.onrep] Functions bound to property replication events are named 'OnRep_' + VariableWithoutPrefix.
-	UPROPERTY(ReplicatedUsing = OnRep_Score)
-	int32 Score = 0;
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::TMyContainer(const TMyContainer& Other)
+	{
+		Reserve(Other.ArrayNum);
+		ConstructItems<ElementType>(GetData(), Other.GetData(), Other.ArrayNum);
+		ArrayNum = Other.ArrayNum;
+	}
 
-	// [naming.func.rpc] Remote procedure calls should be prefixed with the type of RPC + '_'.
-	UFUNCTION(Server, reliable)
-	void Server_SendDataToServer();
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::TMyContainer(TMyContainer&& Other)
+	{
+		MoveFrom(Other);
+	}
 
-	UFUNCTION(Client, reliable)
-	void Client_SendDataToClient();
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::~TMyContainer()
+	{
+		// The memory of AllocatorType is released by the destructor of SecondaryData.
+		DestructItems(GetData(), ArrayNum);
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	TMyContainer<InElementType, InAllocatorType, InDefaultSlack>& TMyContainer<
+		InElementType,
+		InAllocatorType,
+		InDefaultSlack>::operator=(const TMyContainer& Other)
+	{
+		if (this != &Other)
+		{
+			Reset();
+			Reserve(Other.ArrayNum);
+			ConstructItems<ElementType>(GetData(), Other.GetData(), Other.ArrayNum);
+			ArrayNum = Other.ArrayNum;
+		}
+		return *this;
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	TMyContainer<InElementType, InAllocatorType, InDefaultSlack>& TMyContainer<
+		InElementType,
+		InAllocatorType,
+		InDefaultSlack>::operator=(TMyContainer&& Other)
+	{
+		if (this != &Other)
+		{
+			Empty();
+			MoveFrom(Other);
+		}
+		return *this;
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	InElementType& TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::operator[](int32 Index)
+	{
+		checkf(IsValidIndex(Index), TEXT("Index %i is out of bounds [0, %i)"), Index, ArrayNum);
+		return GetData()[Index];
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	const InElementType& TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::operator[](int32 Index) const
+	{
+		checkf(IsValidIndex(Index), TEXT("Index %i is out of bounds [0, %i)"), Index, ArrayNum);
+		return GetData()[Index];
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	int32 TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::Num() const
+	{
+		return ArrayNum;
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	int32 TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::Max() const
+	{
+		return ArrayMax;
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	bool TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::IsEmpty() const
+	{
+		return ArrayNum == 0;
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	bool TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::IsValidIndex(int32 Index) const
+	{
+		return Index >= 0 && Index < ArrayNum;
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	InElementType* TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::GetData()
+	{
+		return HasSpilled() ? static_cast<ElementType*>(SecondaryData.GetAllocation()) : GetInlineData();
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	const InElementType* TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::GetData() const
+	{
+		return HasSpilled() ? static_cast<const ElementType*>(SecondaryData.GetAllocation())
+							: InlineData[0].GetTypedPtr();
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	bool TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::HasSpilled() const
+	{
+		return ArrayMax > DefaultSlack;
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	void TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::Reserve(int32 NumElements)
+	{
+		if (NumElements > ArrayMax)
+		{
+			ResizeTo(CalculateSlackReserve(NumElements));
+		}
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	int32 TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::Add(const ElementType& Item)
+	{
+		CheckAddress(&Item);
+		return Emplace(Item);
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	int32 TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::Add(ElementType&& Item)
+	{
+		CheckAddress(&Item);
+		return Emplace(MoveTemp(Item));
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	template <typename... ArgTypes>
+	int32 TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::Emplace(ArgTypes&&... Args)
+	{
+		if (ArrayNum == ArrayMax)
+		{
+			ResizeTo(CalculateSlackGrow(ArrayNum + 1));
+		}
+
+		const int32 Index = ArrayNum;
+		::new (static_cast<void*>(GetData() + Index)) ElementType(Forward<ArgTypes>(Args)...);
+		++ArrayNum;
+		return Index;
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	void TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::RemoveAt(int32 Index)
+	{
+		checkf(IsValidIndex(Index), TEXT("Index %i is out of bounds [0, %i)"), Index, ArrayNum);
+		ElementType* Data = GetData();
+		DestructItem(Data + Index);
+		FMemory::Memmove(Data + Index, Data + Index + 1, sizeof(ElementType) * (ArrayNum - Index - 1));
+		--ArrayNum;
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	void TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::RemoveAtSwap(int32 Index)
+	{
+		checkf(IsValidIndex(Index), TEXT("Index %i is out of bounds [0, %i)"), Index, ArrayNum);
+		ElementType* Data = GetData();
+		DestructItem(Data + Index);
+		--ArrayNum;
+		if (Index != ArrayNum)
+		{
+			FMemory::Memcpy(Data + Index, Data + ArrayNum, sizeof(ElementType));
+		}
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	int32 TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::Remove(const ElementType& Item)
+	{
+		// The item is compared after elements were destroyed, so it must not be part of this container.
+		CheckAddress(&Item);
+
+		ElementType* Data = GetData();
+		int32 NumKept = 0;
+		for (int32 Index = 0; Index < ArrayNum; ++Index)
+		{
+			if (Data[Index] == Item)
+			{
+				DestructItem(Data + Index);
+				continue;
+			}
+
+			if (NumKept != Index)
+			{
+				FMemory::Memcpy(Data + NumKept, Data + Index, sizeof(ElementType));
+			}
+			++NumKept;
+		}
+
+		const int32 NumRemoved = ArrayNum - NumKept;
+		ArrayNum = NumKept;
+		return NumRemoved;
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	int32 TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::Find(const ElementType& Item) const
+	{
+		const ElementType* Data = GetData();
+		if constexpr (Private::TCanUseVectorizedFind<ElementType>::Value)
+		{
+			return Private::VectorizedFind(Data, ArrayNum, Item);
+		}
+		else
+		{
+			for (int32 Index = 0; Index < ArrayNum; ++Index)
+			{
+				if (Data[Index] == Item)
+					return Index;
+			}
+			return INDEX_NONE;
+		}
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	bool TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::Contains(const ElementType& Item) const
+	{
+		return Find(Item) != INDEX_NONE;
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	void TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::Reset()
+	{
+		DestructItems(GetData(), ArrayNum);
+		ArrayNum = 0;
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	void TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::Empty()
+	{
+		Reset();
+		if (HasSpilled())
+		{
+			ResizeSecondaryData(0, 0);
+			ArrayMax = DefaultSlack;
+		}
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	InElementType* TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::begin()
+	{
+		return GetData();
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	const InElementType* TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::begin() const
+	{
+		return GetData();
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	InElementType* TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::end()
+	{
+		return GetData() + ArrayNum;
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	const InElementType* TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::end() const
+	{
+		return GetData() + ArrayNum;
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	InElementType* TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::GetInlineData()
+	{
+		return InlineData[0].GetTypedPtr();
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	void TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::CheckAddress(const ElementType* Address) const
+	{
+		checkf(
+			Address < GetData() || Address >= GetData() + ArrayMax,
+			TEXT("Element is a reference into the container itself, which may be invalidated by the operation"));
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	void TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::ResizeTo(int32 NewMax)
+	{
+		check(NewMax > ArrayMax);
+		if (HasSpilled())
+		{
+			ResizeSecondaryData(ArrayNum, NewMax);
+		}
+		else
+		{
+			// First spill: Relocate all inline elements into the newly allocated memory.
+			ResizeSecondaryData(0, NewMax);
+			RelocateConstructItems<ElementType>(SecondaryData.GetAllocation(), GetInlineData(), ArrayNum);
+		}
+		ArrayMax = NewMax;
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	void TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::ResizeSecondaryData(
+		int32 CurrentNum,
+		int32 NewMax)
+	{
+		constexpr SIZE_T NumBytesPerElement = sizeof(ElementType);
+		if constexpr (TAllocatorTraits<AllocatorType>::SupportsElementAlignment)
+		{
+			SecondaryData.ResizeAllocation(CurrentNum, NewMax, NumBytesPerElement, alignof(ElementType));
+		}
+		else
+		{
+			SecondaryData.ResizeAllocation(CurrentNum, NewMax, NumBytesPerElement);
+		}
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	int32 TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::CalculateSlackReserve(int32 NewMax) const
+	{
+		constexpr SIZE_T NumBytesPerElement = sizeof(ElementType);
+		if constexpr (TAllocatorTraits<AllocatorType>::SupportsElementAlignment)
+		{
+			return static_cast<int32>(
+				SecondaryData.CalculateSlackReserve(NewMax, NumBytesPerElement, alignof(ElementType)));
+		}
+		else
+		{
+			return static_cast<int32>(SecondaryData.CalculateSlackReserve(NewMax, NumBytesPerElement));
+		}
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	int32 TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::CalculateSlackGrow(int32 NewMax) const
+	{
+		constexpr SIZE_T NumBytesPerElement = sizeof(ElementType);
+		if constexpr (TAllocatorTraits<AllocatorType>::SupportsElementAlignment)
+		{
+			return static_cast<int32>(
+				SecondaryData.CalculateSlackGrow(NewMax, ArrayMax, NumBytesPerElement, alignof(ElementType)));
+		}
+		else
+		{
+			return static_cast<int32>(SecondaryData.CalculateSlackGrow(NewMax, ArrayMax, NumBytesPerElement));
+		}
+	}
+
+	template <typename InElementType, typename InAllocatorType, int32 InDefaultSlack>
+	void TMyContainer<InElementType, InAllocatorType, InDefaultSlack>::MoveFrom(TMyContainer& Other)
+	{
+		checkf(ArrayNum == 0 && !HasSpilled(), TEXT("Can only move into empty containers without allocation"));
+		if (Other.HasSpilled())
+		{
+			SecondaryData.MoveToEmpty(Other.SecondaryData);
+		}
+		else
+		{
+			RelocateConstructItems<ElementType>(GetInlineData(), Other.GetInlineData(), Other.ArrayNum);
+		}
+
+		ArrayNum = Other.ArrayNum;
+		ArrayMax = Other.ArrayMax;
+		Other.ArrayNum = 0;
+		Other.ArrayMax = DefaultSlack;
+	}
+
+} // namespace OUU::CodingStandard::Templates
+
+//---------------------------------------------------------------------------------------------------------------------
+namespace OUU::CodingStandard
+{
+	/**
+	 * Thread-local linear allocator for temporary data that does not outlive the current frame.
+	 * Each thread bumps a pointer in its own arena, so there is no locking and nothing to free. An arena is reset in
+	 * bulk by its first allocation of a new frame (based on GFrameCounter). Tasks that may run across frame boundaries
+	 * must not use it. Reset memory is poisoned in builds with checks enabled to surface stale pointers.
+	 */
+	class OUUCODINGSTANDARD_API FFrameArena
+	{
+	public:
+		// All allocations are aligned to at least this value.
+		static constexpr uint32 MinAlignment = 16;
+
+		static void* Allocate(SIZE_T NumBytes, uint32 Alignment = MinAlignment);
+
+		/**
+		 * Grow or shrink an allocation of the calling thread's arena. The most recent allocation is resized in place if
+		 * possible. Otherwise the first NumBytesToKeep bytes are copied into a new allocation.
+		 * @param	AllocationFrame	GFrameCounter of the frame in which Ptr was allocated. Arenas reuse their memory
+		 *							in later frames, so keeping bytes of an earlier frame is a fatal error.
+		 * @returns the new allocation, or nullptr if NewNumBytes is 0.
+		 */
+		static void* Reallocate(
+			void* Ptr,
+			SIZE_T NumBytesToKeep,
+			SIZE_T NewNumBytes,
+			uint64 AllocationFrame,
+			uint32 Alignment = MinAlignment);
+	};
+
+	/**
+	 * Container allocator that allocates from the FFrameArena of the calling thread, e.g. for temporary arrays in
+	 * gameplay code: TArray<AActor*, FFrameArenaAllocator>
+	 * Memory is never freed individually, so containers using it must not be kept beyond the current frame.
+	 * Elements are aligned to alignof(ElementType), but at least to FFrameArena::MinAlignment.
+	 */
+	class FFrameArenaAllocator
+	{
+	public:
+		using SizeType = int32;
+
+		enum
+		{
+			NeedsElementType = false
+		};
+		enum
+		{
+			RequireRangeCheck = true
+		};
+
+		class ForAnyElementType
+		{
+		public:
+			ForAnyElementType() = default;
+			ForAnyElementType(const ForAnyElementType&) = delete;
+			ForAnyElementType& operator=(const ForAnyElementType&) = delete;
+
+			void MoveToEmpty(ForAnyElementType& Other);
+			FScriptContainerElement* GetAllocation() const;
+			void ResizeAllocation(SizeType CurrentNum, SizeType NewMax, SIZE_T NumBytesPerElement);
+			void ResizeAllocation(
+				SizeType CurrentNum,
+				SizeType NewMax,
+				SIZE_T NumBytesPerElement,
+				uint32 AlignmentOfElement);
+			SizeType CalculateSlackReserve(SizeType NewMax, SIZE_T NumBytesPerElement) const;
+			SizeType CalculateSlackReserve(SizeType NewMax, SIZE_T NumBytesPerElement, uint32 AlignmentOfElement) const;
+			SizeType CalculateSlackShrink(SizeType NewMax, SizeType CurrentMax, SIZE_T NumBytesPerElement) const;
+			SizeType CalculateSlackShrink(
+				SizeType NewMax,
+				SizeType CurrentMax,
+				SIZE_T NumBytesPerElement,
+				uint32 AlignmentOfElement) const;
+			SizeType CalculateSlackGrow(SizeType NewMax, SizeType CurrentMax, SIZE_T NumBytesPerElement) const;
+			SizeType CalculateSlackGrow(
+				SizeType NewMax,
+				SizeType CurrentMax,
+				SIZE_T NumBytesPerElement,
+				uint32 AlignmentOfElement) const;
+			SIZE_T GetAllocatedSize(SizeType CurrentMax, SIZE_T NumBytesPerElement) const;
+			bool HasAllocation() const;
+			SizeType GetInitialCapacity() const;
+
+		private:
+			FScriptContainerElement* Data = nullptr;
+			// Frame in which Data was allocated, to catch containers that outlive the frame.
+			uint64 AllocationFrame = 0;
+		};
+
+		template <typename ElementType>
+		class ForElementType : public ForAnyElementType
+		{
+		public:
+			using ForAnyElementType::ResizeAllocation;
+
+			ElementType* GetAllocation() const;
+
+			// Containers that don't pass the element alignment still get allocations aligned for ElementType.
+			void ResizeAllocation(SizeType CurrentNum, SizeType NewMax, SIZE_T NumBytesPerElement);
+		};
+	};
+
+	inline void FFrameArenaAllocator::ForAnyElementType::MoveToEmpty(ForAnyElementType& Other)
+	{
+		checkSlow(this != &Other);
+		// Nothing to free, the previous allocation is reclaimed with the arena.
+		Data = Other.Data;
+		Other.Data = nullptr;
+		AllocationFrame = Other.AllocationFrame;
+	}
+
+	inline FScriptContainerElement* FFrameArenaAllocator::ForAnyElementType::GetAllocation() const
+	{
+		// Any access to the elements goes through here, so this catches stale containers before they read memory that
+		// was already reset or handed out again. Reallocate() only catches them once they grow.
+		checkf(
+			!Data || AllocationFrame == GFrameCounter,
+			TEXT("Frame arena memory of frame %llu was accessed in frame %llu. Containers using FFrameArenaAllocator "
+				 "must not be kept beyond the frame they allocated in."),
+			AllocationFrame,
+			GFrameCounter);
+		return Data;
+	}
+
+	inline void FFrameArenaAllocator::ForAnyElementType::ResizeAllocation(
+		SizeType CurrentNum,
+		SizeType NewMax,
+		SIZE_T NumBytesPerElement)
+	{
+		ResizeAllocation(CurrentNum, NewMax, NumBytesPerElement, FFrameArena::MinAlignment);
+	}
+
+	inline void FFrameArenaAllocator::ForAnyElementType::ResizeAllocation(
+		SizeType CurrentNum,
+		SizeType NewMax,
+		SIZE_T NumBytesPerElement,
+		uint32 AlignmentOfElement)
+	{
+		Data = static_cast<FScriptContainerElement*>(FFrameArena::Reallocate(
+			Data,
+			static_cast<SIZE_T>(CurrentNum) * NumBytesPerElement,
+			static_cast<SIZE_T>(NewMax) * NumBytesPerElement,
+			AllocationFrame,
+			AlignmentOfElement));
+		AllocationFrame = GFrameCounter;
+	}
+
+	inline FFrameArenaAllocator::SizeType FFrameArenaAllocator::ForAnyElementType::CalculateSlackReserve(
+		SizeType NewMax,
+		SIZE_T NumBytesPerElement) const
+	{
+		return NewMax;
+	}
+
+	inline FFrameArenaAllocator::SizeType FFrameArenaAllocator::ForAnyElementType::CalculateSlackReserve(
+		SizeType NewMax,
+		SIZE_T NumBytesPerElement,
+		uint32 AlignmentOfElement) const
+	{
+		return CalculateSlackReserve(NewMax, NumBytesPerElement);
+	}
+
+	inline FFrameArenaAllocator::SizeType FFrameArenaAllocator::ForAnyElementType::CalculateSlackShrink(
+		SizeType NewMax,
+		SizeType CurrentMax,
+		SIZE_T NumBytesPerElement) const
+	{
+		// Shrinking can't return memory to the arena, so it would only waste time copying.
+		return CurrentMax;
+	}
+
+	inline FFrameArenaAllocator::SizeType FFrameArenaAllocator::ForAnyElementType::CalculateSlackShrink(
+		SizeType NewMax,
+		SizeType CurrentMax,
+		SIZE_T NumBytesPerElement,
+		uint32 AlignmentOfElement) const
+	{
+		return CalculateSlackShrink(NewMax, CurrentMax, NumBytesPerElement);
+	}
+
+	inline FFrameArenaAllocator::SizeType FFrameArenaAllocator::ForAnyElementType::CalculateSlackGrow(
+		SizeType NewMax,
+		SizeType CurrentMax,
+		SIZE_T NumBytesPerElement) const
+	{
+		return DefaultCalculateSlackGrow(NewMax, CurrentMax, NumBytesPerElement, false);
+	}
+
+	inline FFrameArenaAllocator::SizeType FFrameArenaAllocator::ForAnyElementType::CalculateSlackGrow(
+		SizeType NewMax,
+		SizeType CurrentMax,
+		SIZE_T NumBytesPerElement,
+		uint32 AlignmentOfElement) const
+	{
+		return DefaultCalculateSlackGrow(NewMax, CurrentMax, NumBytesPerElement, false, AlignmentOfElement);
+	}
+
+	inline SIZE_T FFrameArenaAllocator::ForAnyElementType::GetAllocatedSize(
+		SizeType CurrentMax,
+		SIZE_T NumBytesPerElement) const
+	{
+		return static_cast<SIZE_T>(CurrentMax) * NumBytesPerElement;
+	}
+
+	inline bool FFrameArenaAllocator::ForAnyElementType::HasAllocation() const
+	{
+		return Data != nullptr;
+	}
+
+	inline FFrameArenaAllocator::SizeType FFrameArenaAllocator::ForAnyElementType::GetInitialCapacity() const
+	{
+		return 0;
+	}
+
+	template <typename ElementType>
+	ElementType* FFrameArenaAllocator::ForElementType<ElementType>::GetAllocation() const
+	{
+		return static_cast<ElementType*>(ForAnyElementType::GetAllocation());
+	}
+
+	template <typename ElementType>
+	void FFrameArenaAllocator::ForElementType<ElementType>::ResizeAllocation(
+		SizeType CurrentNum,
+		SizeType NewMax,
+		SIZE_T NumBytesPerElement)
+	{
+		ForAnyElementType::ResizeAllocation(CurrentNum, NewMax, NumBytesPerElement, alignof(ElementType));
+	}
+} // namespace OUU::CodingStandard
+
+template <>
+struct TAllocatorTraits<OUU::CodingStandard::FFrameArenaAllocator> :
+	TAllocatorTraitsBase<OUU::CodingStandard::FFrameArenaAllocator>
+{
+	enum
+	{
+		SupportsMove = true
+	};
+	enum
+	{
+		IsZeroConstruct = true
+	};
+	enum
+	{
+		SupportsElementAlignment = true
+	};
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * This is a sample character class that is not meant to be exported or used in other modules.
+ */
+UCLASS()
+// [class.export] Add DLL export macros (here: OUUCODINGSTANDARD_API) to all types declared in headers that need
+// dynamic linkage.
+// [naming.class] Class names should be prefixed with Unreal prefix, then optionally the module prefix (OUU or project
+// prefix -> see [naming.modules]).
+// The unreal prefix depends on the type:
+// - T: Template classes and structs T.
+// - C: Concept traits -> see Template/Models.h
+// - U: Classes that inherit from UObject
+// - A: Classes that inherit from AActor
+// - S: Classes that inherit from SWidget
+// - I: Interface classes -> see [naming.iinterface]
+// - F: All other classes -> same as structs -> see [naming.struct]
+class OUUCODINGSTANDARD_API AOUUExampleCharacter : public ACharacter, public IOUUExampleColorableInterface
+{
+	// [order.members] Within any class/struct, members must be sorted by the following criteria in order:
+	// 1. Access Level -> see [order.access]
+	// 2. Nested categories (see items below)
+	//
+	// Categories are defined as follows:
+	// 1. Generated body macros -> see [macro.genbody]
+	// 2. Types, aliases and constants
+	//     2.1 Enums
+	//     2.2 Structs
+	//     2.3 Classes
+	//     2.4 Aliases
+	//     2.5 Constants
+	// 3. Constructors, destructors
+	//     3.1 Default constructor
+	//     3.2 Custom constructor
+	//     3.3 Copy/move constructors
+	//     3.4 Destructor
+	// 4. Member functions
+	//     4.1 Non-static, non-overridden, non-operator member functions
+	//     4.2 Operators
+	//     4.3 Static functions
+	// 5. Interface functions / Overriden virtual functions
+	//    Each base class counts as its own category (here: UObject, AActor, APawn, ACharacter,
+	//    IExampleColorableInterface) -> see [class.overrides]
+	// 6. Fields
+	//     6.1 Constant fields
+	//     6.2 Non-constant fields
+
+	// [macro.genbody] Use GENERATED_BODY() instead of the deprecated GENERATED_UCLASS_BODY(),
+	// GENERATED_IINTERFACE_BODY(), etc.
+	GENERATED_BODY()
+
+	// [order.access] Order and group members by access level: public > protected > private.
+	// In total a class should therefore have max three access level specifiers.
+	// Always add an initial access level declaration after GENERATED_BODY().
+	// Do not rely on implicit access (i.e. struct = public, class = private).
+public:
+	// [alias.using] Use using declarations for aliasing instead of typedefs
+	// [naming.alias] Adopt the prefix of the aliased type, except for the following exceptions:
+	// - template type arguments -> see [naming.template.alias]
+	// - concrete template instantiations -> see [naming.alias.template.instance]
+	using FCharacterData = OUU::CodingStandard::FNumericAwesomeness;
+
+	// [naming.alias.template.instance] When aliasing a template instance, use F as prefix, e.g.
+	using FCharacterMeshPtr = TWeakObjectPtr<USkeletalMeshComponent>;
+
+	DECLARE_EVENT_OneParam(AOUUExampleCharacter, FOnAwesomenessChanged, EAwesomenessLevel);
+	FOnAwesomenessChanged OnAwesomenessChanged;
+
+	// [member.constant.primitive] Primitive constants should be declared as constexpr, if possible.
+	// Prefer this any time over defines, c-style enums or static const values that are defined in cpp.
+	static constexpr int32 NumBodyParts = 2;
+
+	// Indices of the body parts in all body part tables
+	static constexpr int32 HeadBodyPartIndex = 0;
+	static constexpr int32 TorsoBodyPartIndex = 1;
+
+	// Body part colors are written as RGB to the custom primitive data of the body and head mesh, starting at
+	// BodyPartIndex * BodyPartColorPrimitiveDataStride. Materials read them via per-instance custom data.
+	static constexpr int32 BodyPartColorPrimitiveDataStride = 3;
+
+	static constexpr int32 NumBodyPartColors = static_cast<int32>(EOUUExampleBodyPartColor::Count);
+
+	// Used body part colors mask of characters that use every color on at least one body part.
+	static constexpr uint8 AllBodyPartColorsMask = (1 << NumBodyPartColors) - 1;
+	static_assert(NumBodyPartColors <= 8, "UsedBodyPartColorsMask needs one bit per color");
+
+	// [member.constant.complex] Complex constants (like FNames) that cannot be declared as constexpr should be declared
+	// like this:
+	static const FName HeadBodyPartName;
+	static const FName TorsoBodyPartName;
+
+	// Name IDs of all body parts, indexed by body part index
+	static const FName BodyPartNames[NumBodyParts];
+
+	// Awesomeness reason stored by SetAwesomeness()
+	static const FName SetAwesomenessReason;
+
+	// [uclass.ctor] Prefer the parameterless default constructor for UObjects instead of the one using
+	// FObjectInitializer.
+	AOUUExampleCharacter();
+
+	AOUUExampleCharacter(USkeletalMesh* InSkeletalMesh, EOUUExampleBodyPartColor InHeadColor);
+
+	// [doc.delegate.instance] Do not duplicate parameter docs for delegate at the instance.
+	// Instad, focus on the things that changes between instances.
+
+	// This is called for any body part that is re-colored.
+	// This delegate is called before the more specific OnXYColorChanged events below.
+
+	// [naming.delegate.instance] Delegate instances are prefixed with 'On'. The name must be an event in past tense.
+	UPROPERTY(BlueprintAssignable)
+	FOnExampleColorablePartColorChanged OnBodyPartColorChanged;
+
+	// [doc.omit] Omit doc comments that are obvious from the type/member naming.
+	// Restating the obvious just wastes space and time.
+	UPROPERTY(BlueprintAssignable)
+	FOnExampleColorablePartColorChanged OnHeadColorChanged;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnExampleColorablePartColorChanged OnTorsoColorChanged;
+
+	// This is called once per ColorBodyPart() or ColorBodyParts() call with all body part colors that changed.
+	// ColorBodyParts() calls the per body part events above for every changed body part first, so listeners of
+	// those events don't miss outfit swaps.
+	UPROPERTY(BlueprintAssignable)
+	FOnExampleColorablePartColorsChanged OnBodyPartColorsChanged;
+
+	// Native counterparts of the events above that should be preferred by C++ listeners.
+	// Each native event is called right before its dynamic counterpart.
+	FOnExampleColorablePartColorChangedNative OnBodyPartColorChangedNative;
+	FOnExampleColorablePartColorChangedNative OnHeadColorChangedNative;
+	FOnExampleColorablePartColorChangedNative OnTorsoColorChangedNative;
+	FOnExampleColorablePartColorsChangedNative OnBodyPartColorsChangedNative;
+
+	// [member.accessor] Prefer declaring accessor functions (getters + setters) over making member field public.
+	EAwesomenessLevel GetAwesomenessLevel() const;
+	int32 GetAwesomeness() const;
+	void SetAwesomeness(int32 Awesomeness);
+
+	/**
+	 * Broadcast OnAwesomenessChanged for awesomeness changes that were deferred since the last flush.
+	 * Only the final level is broadcast and only if it differs from the level before the first deferred change.
+	 * Called by UOUUExampleCharacterSubsystem at the end of the world tick, once the update interval of the current
+	 * significance bucket passed.
+	 * -> see ouu.CodingStandard.DeferAwesomenessEvents
+	 */
+	void FlushDeferredAwesomenessChanged();
+
+	// Checks if all possible colors are assigned to this character in any body part.
+	// This is a single mask compare, because the used colors are tracked incrementally whenever a body part changes.
+	bool HasAllColorsPossible() const;
+
+	// One bit per EOUUExampleBodyPartColor that is used by at least one body part -> see AllBodyPartColorsMask
+	uint8 GetUsedBodyPartColorsMask() const;
+
+	int32 GetScore() const;
+	void SetScore(int32 NewScore);
+
+	EOUUExampleCharacterSignificance GetSignificance() const;
+
+	/**
+	 * Index-based fast path of ColorBodyPart().
+	 * @param		BodyPartIndex	Index of the body part to be colored -> see FindBodyPartIndex()
+	 * @param		BodyPartColor	Color preset to apply to the body-part.
+	 * @returns		true if the body part index was valid and successfully colored.
+	 */
+	bool ColorBodyPartByIndex(int32 BodyPartIndex, EOUUExampleBodyPartColor BodyPartColor);
+
+	EOUUExampleBodyPartColor GetBodyPartColor(int32 BodyPartIndex) const;
+
+	/**
+	 * Send data to all clients via Multicast_SendDataToEveryone(). Server only.
+	 * If multicast batching is enabled (ouu.CodingStandard.BatchMulticastRPCs), the data is queued and sent together
+	 * with the data of all other characters in a single RPC at the end of the frame.
+	 * NOTE: Batching changes who receives the data -> see AOUUExampleCharacterRPCBatcher
+	 */
+	void SendDataToEveryone();
+
+	/**
+	 * Send data to the server via Server_SendDataToServer(). Client only.
+	 * Requests are coalesced, so at most one RPC is sent per frame no matter how often this is called.
+	 */
+	void SendDataToServer();
+
+	// Send the coalesced data of SendDataToServer(). Called by UOUUExampleCharacterSubsystem at the end of the frame.
+	void FlushPendingServerData();
+
+	// Number of Server_SendDataToServer() calls the server dropped because of the rate limit, e.g. to find spammers.
+	int32 GetNumDroppedServerRPCs() const;
+
+	/**
+	 * Look up the index of a body part in a precomputed name to index map.
+	 * Resolve the index once and use the index-based functions above in hot code paths.
+	 * @param		BodyPartName	Name ID of the body part.
+	 * @returns		the body part index or INDEX_NONE if there is no body part with the given name.
+	 */
+	static int32 FindBodyPartIndex(FName BodyPartName);
+
+	// [member.order.overrides] Overridden functions are grouped by the class where the function was first declared.
+	// Each group must start with a comment indicating the originating parent class.
+	// That is the parent class where the function was first declared.
+
+	// [member.virtual] Overriden virtual functions must be marked as either override or final.
+	// Do NOT use the virtual keyword.
+
+	// [doc.member.virtual] Virtual overrides should not need to be documented as the API should be consistent with
+	// the initial declaration.
+
+	// -- AActor interface
+	void PostInitializeComponents() override;
+	void BeginPlay() override;
+	void EndPlay(EEndPlayReason::Type EndPlayReason) override;
+
+	// -- IOUUExampleColorableInterface
+	bool ColorBodyPart(FName BodyPartName, EOUUExampleBodyPartColor BodyPartColor) override;
+	bool ColorBodyParts(TConstArrayView<FOUUExampleBodyPartColorEntry> NewBodyPartColors) override;
+
+protected:
+	// [naming.func.onrep] Functions bound to property replication events are named 'OnRep_' + VariableWithoutPrefix.
+	UPROPERTY(ReplicatedUsing = OnRep_Score)
+	int32 Score = 0;
+
+	// [naming.func.rpc] Remote procedure calls should be prefixed with the type of RPC + '_'.
+	UFUNCTION(Server, reliable)
+	void Server_SendDataToServer();
+
+	UFUNCTION(Client, reliable)
+	void Client_SendDataToClient();
 
 	// [rpc.reliability] Functions should be marked as unreliable whenever possible. This is mostly for cosmetic events
 	// that are sent to clients.
@@ -466,33 +1608,372 @@ private:
 		// ...
 	};
 
-	// [member.init] Initialize member via assignment, unless it's a default constructible struct
-	UPROPERTY(VisibleAnywhere)
-	EOUUExampleBodyPartColor HeadColor;
+	static_assert(NumBodyParts <= MAX_uint8, "Body part indices and color use counts are stored as uint8");
+
+	/**
+	 * Assign a new color to a body part and keep the color use counts and mask up to date.
+	 * All writes to body part colors must go through this function.
+	 */
+	void SetBodyPartColor(int32 BodyPartIndex, EOUUExampleBodyPartColor NewColor);
+
+	/**
+	 * Validate a requested color and apply it to a body part.
+	 * @returns		true if the request was valid, regardless of whether the color actually changed.
+	 */
+	bool TryApplyBodyPartColor(
+		int32 BodyPartIndex,
+		EOUUExampleBodyPartColor NewColor,
+		EOUUExampleBodyPartColor& OutOldColor);
+
+	// Common handling for body part color changes that were applied together. Called once per batch of changes.
+	void HandleBodyPartColorsChanged();
+
+	// Write the body part colors to the custom primitive data of the meshes. Does nothing on dedicated servers.
+	void UpdateBodyPartColorPrimitiveData();
+
+	// Raise the native and dynamic per body part events.
+	void BroadcastBodyPartColorChanged(
+		int32 BodyPartIndex,
+		EOUUExampleBodyPartColor OldBodyPartColor,
+		EOUUExampleBodyPartColor NewBodyPartColor) const;
+
+	// Raise the native and dynamic batched events. The dynamic event is only raised (and its array only allocated) if
+	// it has any listeners.
+	void BroadcastBodyPartColorsChanged(TConstArrayView<FOUUExampleBodyPartColorChange> BodyPartColorChanges) const;
+	void AddBodyPartColorUse(EOUUExampleBodyPartColor Color);
+	void RemoveBodyPartColorUse(EOUUExampleBodyPartColor Color);
+
+	// Recount the color uses of all body parts.
+	void ResetBodyPartColorUses();
+
+	// Fill the replicated body part colors from the local body part color table. Server only.
+	void InitializeReplicatedBodyPartColors();
+
+	// Apply a body part color that was received from the server.
+	void HandleBodyPartColorReplicated(int32 BodyPartIndex, EOUUExampleBodyPartColor NewColor);
+
+	// @returns true if the awesomeness change was deferred, false if it has to be broadcast immediately.
+	bool TryDeferAwesomenessChanged(EAwesomenessLevel AwesomenessLevelBefore);
+
+	// Broadcast OnAwesomenessChanged immediately or deferred, depending on ouu.CodingStandard.DeferAwesomenessEvents.
+	// Deferred events are flushed at the update interval of the significance bucket of the character.
+	void BroadcastAwesomenessChanged(EAwesomenessLevel AwesomenessLevelBefore);
+
+	// @returns true if the update interval of the current significance bucket passed since the last deferred flush.
+	bool IsDeferredAwesomenessFlushDue(double CurrentTime) const;
+
+	// Apply the tick intervals of a significance bucket. Called by the significance manager.
+	void SetSignificance(EOUUExampleCharacterSignificance NewSignificance);
+
+	// Token bucket rate limit for Server_SendDataToServer(). Server only.
+	// @returns true if the RPC may be processed.
+	bool TryConsumeServerDataToken();
+
+	void RegisterWithCharacterSubsystem();
+	void UnregisterFromCharacterSubsystem();
+
+	/**
+	 * Reset all gameplay state to the class defaults, unbind all external listeners and deactivate the character, so
+	 * it can be reused for another spawn. Called by UOUUExampleCharacterSubsystem::ReleaseCharacter().
+	 */
+	void ResetForPool();
+
+	// Reactivate a character that was reset via ResetForPool(). Called by UOUUExampleCharacterSubsystem.
+	void ActivateFromPool(const FTransform& Transform);
 
 	// [member.init] Initialize member via assignment, unless it's a default constructible struct or initialized from a
 	// constructor parameter.
+	// Color of each body part, indexed by body part index. Value-initialized to Red, except for the head color that is
+	// passed to the constructor.
 	UPROPERTY(VisibleAnywhere)
-	EOUUExampleBodyPartColor TorsoColor = EOUUExampleBodyPartColor::Red;
+	EOUUExampleBodyPartColor BodyPartColors[NumBodyParts] = {};
+
+	// Replicated copy of BodyPartColors. Clients apply changes to BodyPartColors from the item callbacks.
+	UPROPERTY(Replicated)
+	FOUUExampleBodyPartColorArray ReplicatedBodyPartColors;
 
 	// [naming.bool] Boolean variables and member fields are prefixed with b as in the Epic conventions.
 	// Use verb as name with prefixes such as is, has, can or similar.
 	// Should be in positive form to avoid double negatives or even triple negatives.
 	bool bWasColorChanged = false;
 
+	// [member.init] Initialize member via assignment, unless it's a default constructible struct
 	FCharacterData CharacterData;
 
 	// [nullptr] Use nullptr instead of NULL macro or 0 literal in all cases.
 	UPROPERTY(VisibleAnywhere)
 	USkeletalMeshComponent* HeadMeshComponent = nullptr;
 
+	// If true, the head mesh copies the pose of the body mesh instead of evaluating its own animation.
+	// This also disables the head mesh tick. The body mesh is throttled by the significance tick intervals instead of
+	// animation update rate optimizations, so the pose is not throttled twice.
+	UPROPERTY(EditDefaultsOnly, Category = "Animation")
+	bool bDriveHeadByLeaderPose = true;
+
 	FDelegateHandle BoundDelegateHandle;
 
+	// Awesomeness level before the first deferred change of this frame. Only set while a change is pending.
+	TOptional<EAwesomenessLevel> AwesomenessLevelBeforeDeferral;
+
+	// World time of the last FlushDeferredAwesomenessChanged() call that broadcast a change.
+	double LastDeferredAwesomenessFlushTime = 0.0;
+
+	EOUUExampleCharacterSignificance Significance = EOUUExampleCharacterSignificance::High;
+
+	bool bHasPendingServerData = false;
+
+	// Subsystem this character is registered with between BeginPlay() and EndPlay().
+	UPROPERTY(Transient)
+	UOUUExampleCharacterSubsystem* CharacterSubsystem = nullptr;
+
+	// Index of this character's hot data in the registry of CharacterSubsystem.
+	int32 RegistryIndex = INDEX_NONE;
+
+	// Crowd member entity this character represents while it's promoted. Cleared when the character is released.
+	FOUUExampleCrowdMemberHandle CrowdMember;
+
+	// Remaining Server_SendDataToServer() budget. Starts out full and is clamped to the burst size on first use.
+	float ServerDataTokens = TNumericLimits<float>::Max();
+	double LastServerDataTokenRefillTime = 0.0;
+	int32 NumDroppedServerRPCs = 0;
+
+	// Number of body parts that currently use each color, indexed by EOUUExampleBodyPartColor.
+	uint8 BodyPartColorUseCounts[NumBodyPartColors] = {};
+
+	// One bit per EOUUExampleBodyPartColor that is used by at least one body part.
+	uint8 UsedBodyPartColorsMask = 0;
+
 	UFUNCTION()
 	void HandleOwnAwesomenessChanged(EAwesomenessLevel Awesomeness) const;
 
 	UFUNCTION()
 	void OnRep_Score(int32 ReplicatedScore);
+
+	// Receive the data sent via SendDataToEveryone() on clients.
+	void ReceiveDataFromEveryone();
+
+	friend FOUUExampleBodyPartColorItem;
+	friend class AOUUExampleCharacterRPCBatcher;
+	// The subsystem manages the registry index, crowd link, pooling, significance and deferred events of characters.
+	// It reads the character data it mirrors via the public getters like any other system.
+	friend class UOUUExampleCharacterSubsystem;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Replicated manager actor that sends the multicast data of many characters in a single RPC.
+ * Spawned by UOUUExampleCharacterSubsystem on the server if ouu.CodingStandard.BatchMulticastRPCs is enabled.
+ * It's always relevant, so every client keeps a channel open for it -> see AOUUExampleCharacter::SendDataToEveryone()
+ *
+ * Batching trades delivery guarantees for fewer RPCs:
+ * - A per character multicast only reaches clients the character is relevant for. A batch reaches every client,
+ *   so clients receive the data of characters they don't know about as nullptr and skip it.
+ * - Clients whose channel to the sending character is closed don't get the data either way, but the batch still
+ *   spends bandwidth on the null reference.
+ * Only enable batching if most characters are relevant for most clients and the data may be dropped.
+ */
+UCLASS(Transient, NotPlaceable)
+class OUUCODINGSTANDARD_API AOUUExampleCharacterRPCBatcher : public AInfo
+{
+	GENERATED_BODY()
+public:
+	AOUUExampleCharacterRPCBatcher();
+
+	/**
+	 * Batched version of AOUUExampleCharacter::Multicast_SendDataToEveryone().
+	 * NOTE: The batch is sent to every connection, so senders that are not relevant for a connection arrive as nullptr.
+	 * @param	Senders		Characters that sent data this frame.
+	 */
+	UFUNCTION(NetMulticast, unreliable)
+	void Multicast_SendBatchedDataToEveryone(const TArray<AOUUExampleCharacter*>& Senders);
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Per-world manager of all AOUUExampleCharacter instances.
+ * Mirrors the hot data of all characters that are in play in structure-of-arrays layout, so batch queries run over
+ * contiguous memory instead of chasing pointers to scattered actors.
+ * Represents actor-less crowd members as Mass entities and promotes them to characters near players.
+ * Flushes deferred character events once per frame after all actors have ticked.
+ */
+UCLASS()
+class OUUCODINGSTANDARD_API UOUUExampleCharacterSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+public:
+	static constexpr int32 NumAwesomenessLevels = static_cast<int32>(EAwesomenessLevel::NumOf);
+	static constexpr int32 NumSignificances = static_cast<int32>(EOUUExampleCharacterSignificance::Count);
+
+	// Add a character to the registry. Called by AOUUExampleCharacter::BeginPlay().
+	void RegisterCharacter(AOUUExampleCharacter& Character);
+
+	// Remove a character from the registry. Called by AOUUExampleCharacter::EndPlay().
+	void UnregisterCharacter(AOUUExampleCharacter& Character);
+
+	// Copy the hot data of a registered character into the registry. Must be called whenever any of it changed.
+	void UpdateCharacter(const AOUUExampleCharacter& Character);
+
+	int32 GetNumCharacters() const;
+
+	// @returns the number of registered characters per awesomeness level, indexed by EAwesomenessLevel.
+	TStaticArray<int32, NumAwesomenessLevels> CountCharactersByAwesomenessLevel() const;
+
+	// @returns the number of registered characters that have all possible colors on their body parts.
+	int32 CountCharactersWithAllColors() const;
+
+	int64 GetTotalScore() const;
+
+	// @returns the number of registered characters per significance bucket.
+	TStaticArray<int32, NumSignificances> CountCharactersBySignificance() const;
+
+	/**
+	 * Re-evaluate the awesomeness levels of all registered characters in parallel.
+	 * Levels are computed on worker threads in chunks. Afterwards OnAwesomenessChanged is broadcast on the game thread
+	 * for all characters whose level changed, e.g. because ouu.CodingStandard.MinAwesomeness was changed.
+	 * This is called automatically at the end of any frame in which the awesomeness threshold changed.
+	 */
+	void UpdateAwesomenessLevels();
+
+	/**
+	 * Add a lightweight crowd member that has no actor representation while no player is close to it.
+	 * On the server, crowd members near any player viewpoint are promoted to full AOUUExampleCharacter actors and
+	 * demoted again once all players moved away (see ouu.CodingStandard.Crowd.* cvars).
+	 * @returns the handle of the crowd member, which stays valid until ResetCrowd() is called.
+	 */
+	FOUUExampleCrowdMemberHandle AddCrowdMember(
+		const FVector& Location,
+		int32 Awesomeness,
+		TConstArrayView<EOUUExampleBodyPartColor> BodyPartColors = {});
+
+	// Destroy all crowd member entities and release the actors of promoted crowd members.
+	void ResetCrowd();
+
+	int32 GetNumCrowdMembers() const;
+
+	// @returns the actor representing the crowd member or nullptr if the crowd member is not promoted.
+	AOUUExampleCharacter* GetPromotedCrowdCharacter(FOUUExampleCrowdMemberHandle CrowdMember) const;
+
+	/**
+	 * Re-evaluate the awesomeness levels of all crowd members with UOUUExampleCrowdAwesomenessProcessor.
+	 * Levels of promoted crowd members are updated by their actors and copied back when they are demoted.
+	 * This is called automatically at the end of any frame in which the awesomeness threshold changed.
+	 */
+	void UpdateCrowdAwesomenessLevels();
+
+	// Character class that is spawned for promoted crowd members. Defaults to AOUUExampleCharacter.
+	void SetCrowdCharacterClass(TSubclassOf<AOUUExampleCharacter> CharacterClass);
+
+	/**
+	 * Take a character of the given class from the pool or spawn a new one if there is no pooled character.
+	 * Pooled characters are reset to their class defaults and have no external delegate bindings.
+	 * Only call this on the server or in standalone games. Clients receive the characters via replication.
+	 * @param	CharacterClass	Exact class of the character. Defaults to AOUUExampleCharacter if null.
+	 */
+	AOUUExampleCharacter* AcquireCharacter(
+		TSubclassOf<AOUUExampleCharacter> CharacterClass,
+		const FTransform& Transform);
+
+	/**
+	 * Reset a character and keep it in the pool for AcquireCharacter() instead of destroying it.
+	 * The character is destroyed instead if the pool is full -> see ouu.CodingStandard.CharacterPool.MaxSize
+	 * Promoted crowd members may be released by anyone: their data is copied back to the crowd member first.
+	 */
+	void ReleaseCharacter(AOUUExampleCharacter& Character);
+
+	// Spawn characters into the pool ahead of time, e.g. during a loading screen or before a wave starts.
+	void PrewarmCharacterPool(TSubclassOf<AOUUExampleCharacter> CharacterClass, int32 NumCharacters);
+
+	int32 GetNumPooledCharacters() const;
+
+	// Flush the deferred awesomeness changes of the character at the end of the current world tick.
+	void QueueDeferredAwesomenessChanged(AOUUExampleCharacter& Character);
+
+	// Send the multicast data of the character together with all other queued characters at the end of the current
+	// world tick.
+	void QueueMulticastData(AOUUExampleCharacter& Character);
+
+	// Flush the coalesced server data of the character at the end of the current world tick.
+	void QueuePendingServerData(AOUUExampleCharacter& Character);
+
+	// -- USubsystem interface
+	void Initialize(FSubsystemCollectionBase& Collection) override;
+	void Deinitialize() override;
+
+	// -- UWorldSubsystem interface
+	void OnWorldBeginPlay(UWorld& InWorld) override;
+
+protected:
+	// -- UWorldSubsystem interface
+	bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// Hot data of all registered characters. All arrays are indexed by the registry index of the character.
+	struct FCharacterRegistry
+	{
+		// Characters are guaranteed to be alive, because they unregister themselves in EndPlay().
+		TArray<AOUUExampleCharacter*> Characters;
+		TArray<int32> Awesomeness;
+		TArray<EAwesomenessLevel> AwesomenessLevels;
+		TArray<uint8> UsedBodyPartColorsMasks;
+		TArray<int32> Scores;
+		TArray<EOUUExampleCharacterSignificance> Significances;
+	};
+
+	FCharacterRegistry Registry;
+
+	// Mass entities and queries of the crowd. Mass is only used in the implementation of this module, so the type is
+	// declared in a private header.
+	TPimplPtr<FOUUExampleCrowd> Crowd;
+
+	UPROPERTY(Transient)
+	UOUUExampleCrowdAwesomenessProcessor* CrowdAwesomenessProcessor = nullptr;
+
+	// Awesomeness threshold that was used for the last crowd awesomeness evaluation.
+	// Unset until the first evaluation, because every int32 is a valid threshold.
+	TOptional<int32> LastCrowdMinAwesomeness;
+
+	UPROPERTY(Transient)
+	TSubclassOf<AOUUExampleCharacter> CrowdCharacterClass;
+
+	// Deactivated characters that were released via ReleaseCharacter().
+	UPROPERTY(Transient)
+	TArray<AOUUExampleCharacter*> PooledCharacters;
+
+	// Scratch buffer for UpdateAwesomenessLevels() that is kept to avoid allocations.
+	TArray<EAwesomenessLevel> UpdatedAwesomenessLevels;
+
+	// Awesomeness threshold that was used for the last UpdateAwesomenessLevels() call.
+	// Unset until the first call, because every int32 is a valid threshold.
+	TOptional<int32> LastMinAwesomeness;
+
+	TArray<TWeakObjectPtr<AOUUExampleCharacter>> CharactersWithDeferredAwesomenessChanges;
+
+	TArray<TWeakObjectPtr<AOUUExampleCharacter>> CharactersWithQueuedMulticastData;
+
+	TArray<TWeakObjectPtr<AOUUExampleCharacter>> CharactersWithPendingServerData;
+
+	// Spawned on the server when the world begins play with batching enabled, so clients have an open actor channel
+	// for it before the first batch is sent. Batches sent through a channel that is still opening are dropped, because
+	// they are unreliable. If batching is enabled later, it's spawned by the first flush.
+	UPROPERTY(Transient)
+	AOUUExampleCharacterRPCBatcher* RPCBatcher = nullptr;
+
+	FDelegateHandle WorldPostActorTickHandle;
+
+	void HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+	void FlushDeferredAwesomenessChanges();
+	void FlushMulticastData();
+	void FlushPendingServerData();
+	void SpawnRPCBatcher(UWorld& InWorld);
+	AOUUExampleCharacter* SpawnCharacter(TSubclassOf<AOUUExampleCharacter> CharacterClass, const FTransform& Transform);
+	void GetPlayerViewpoints(TArray<FTransform, TInlineAllocator<4>>& OutViewpoints) const;
+	void UpdateSignificance(TConstArrayView<FTransform> PlayerViewpoints);
+	FMassEntityManager* GetEntityManager() const;
+	void UpdateCrowd(TConstArrayView<FTransform> PlayerViewpoints);
+	void PromoteCrowdMember(FMassEntityHandle CrowdMember);
+	void DemoteCrowdMember(FMassEntityHandle CrowdMember);
+	// Copy the data of a promoted crowd member character back to its entity and clear the links in both directions.
+	void UnlinkCrowdCharacter(AOUUExampleCharacter& Character);
 };
 
 //---------------------------------------------------------------------------------------------------------------------